@@ -0,0 +1,122 @@
+// .h
+// Actor Pool Class Script
+// by Kyle Furey
+
+#pragma once
+#include "../Actors/Actor.h"
+
+namespace FureyEngine {
+    // Forward declaration of world.
+    class World;
+
+    /**
+     * Stores destroyed actors of a single type within a world so they can be spawned again without reallocating.<br/>
+     * Pooled actors keep their components, which are removed and attached again along with their actor.
+     */
+    class ActorPoolBase {
+    protected:
+        // POOL
+
+        /** The world that owns this pool. */
+        World *MyWorld = nullptr;
+
+        /** Each destroyed actor waiting to be spawned again, which keeps its position in this list while pooled. */
+        std::list<std::shared_ptr<Actor> > Inactive;
+
+        /** The total number of actors this pool has allocated, including ones currently in its world. */
+        int Allocated = 0;
+
+        /** Marks the given newly allocated actor as belonging to this pool. */
+        void Track(Actor *PooledActor) {
+            PooledActor->Pool = this;
+            ++Allocated;
+        }
+
+        /** Stores the given newly allocated actor in this pool before it has ever been spawned. */
+        void Store(const std::shared_ptr<Actor> &PooledActor) {
+            Inactive.push_back(PooledActor);
+            PooledActor->WorldIterator = std::prev(Inactive.end());
+            Track(PooledActor.get());
+        }
+
+        /** Worlds move actors between their actor list and this pool. */
+        friend class World;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new empty actor pool for the given world. */
+        explicit ActorPoolBase(World *OwningWorld) : MyWorld(OwningWorld) {
+        }
+
+        /** Delete copy constructor. */
+        ActorPoolBase(const ActorPoolBase &Copied) = delete;
+
+        /** Delete move constructor. */
+        ActorPoolBase(ActorPoolBase &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        ActorPoolBase &operator=(const ActorPoolBase &Copied) = delete;
+
+        /** Delete move constructor. */
+        ActorPoolBase &operator=(ActorPoolBase &&Moved) = delete;
+
+        // DESTRUCTOR
+
+        /** Properly destroys this actor pool and each actor stored in it. */
+        virtual ~ActorPoolBase() = default;
+
+        // POOL
+
+        /** Returns the number of destroyed actors waiting to be spawned again. */
+        [[nodiscard]] int Count() const {
+            return static_cast<int>(Inactive.size());
+        }
+
+        /** Returns the total number of actors this pool has allocated, including ones currently in its world. */
+        [[nodiscard]] int AllocatedCount() const {
+            return Allocated;
+        }
+
+        /** Frees each destroyed actor waiting in this pool. */
+        void Clear() {
+            Allocated -= static_cast<int>(Inactive.size());
+            Inactive.clear();
+        }
+    };
+
+    /**
+     * Recycles actors of the given type within a world.<br/>
+     * Destroying a pooled actor calls its destroy events and Reset(), then stores it here instead of freeing it.<br/>
+     * Spawning from the pool reuses a stored actor, calling Reuse() instead of its spawn events<br/>
+     * once it has spawned before, then its start events again.
+     */
+    template<typename ActorType>
+    class ActorPool final : public ActorPoolBase {
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new empty actor pool for the given world. */
+        explicit ActorPool(World *OwningWorld) : ActorPoolBase(OwningWorld) {
+        }
+
+        // POOL
+
+        /**
+         * Spawns an actor of this pool's type in its world, reusing a destroyed actor if one is available.<br/>
+         * The given arguments are only used to construct a new actor when the pool is empty.<br/>
+         * This is defined in World.h once the world class is complete.
+         */
+        template<typename... ArgumentTypes>
+        Reference<ActorType> Spawn(const Transform &Transform, ArgumentTypes... Arguments);
+
+        /**
+         * Allocates destroyed actors until this pool stores at least the given number of them.<br/>
+         * This is defined in World.h once the world class is complete.
+         */
+        template<typename... ArgumentTypes>
+        void Reserve(const int &Count, ArgumentTypes... Arguments);
+    };
+}
@@ -3,6 +3,7 @@
 // by Kyle Furey
 
 #include "Actor.h"
+#include "../Worlds/World.h"
 
 namespace FureyEngine {
     // CONSTRUCTORS
@@ -26,6 +27,7 @@ namespace FureyEngine {
     void Actor::SetWorld(const std::shared_ptr<World> &OwningWorld) {
         if (!MyWorld) {
             MyWorld = OwningWorld;
+            SpawnOrder = ++OwningWorld->SpawnedObjects;
             ++TotalActors;
         } else {
             throw std::runtime_error(
@@ -44,6 +46,24 @@ namespace FureyEngine {
         return SpawnTimePoint;
     }
 
+    // Returns the order this actor was spawned in relative to every other actor and component in its world.
+    // Sort by this instead of by address so iteration order is the same each time a world is simulated.
+    unsigned long long Actor::GetSpawnOrder() const {
+        return SpawnOrder;
+    }
+
+    // Returns whether this actor is returned to a pool instead of being freed when destroyed.
+    bool Actor::IsPooled() const {
+        return Pool != nullptr;
+    }
+
+    // REFERENCE
+
+    // Returns this actor's handle in the reference registry.
+    const ReferenceHandle &Actor::GetHandle() const {
+        return MySlot.Handle();
+    }
+
     // COMPONENTS
 
     // Returns the first component that matches the given name
@@ -57,8 +77,53 @@ namespace FureyEngine {
         return nullref;
     }
 
+    // Replaces or removes the given component in this actor's component type index before it is deleted.
+    void Actor::UnindexComponent(Component *RemovedComponent) {
+        const auto Found = ComponentsByType.find(typeid(*RemovedComponent));
+        if (Found == ComponentsByType.end() || Found->second != RemovedComponent) {
+            return;
+        }
+        for (const auto &Component: Components) {
+            if (Component.get() != RemovedComponent && typeid(*Component) == typeid(*RemovedComponent)) {
+                Found->second = Component.get();
+                return;
+            }
+        }
+        ComponentsByType.erase(Found);
+    }
+
+    // Queues the given newly attached component to be attached and started by this actor's world.
+    void Actor::AddToWorld(Component *AddedComponent) {
+        if (MyWorld) {
+            AddedComponent->AttachOrder = ++MyWorld->SpawnedObjects;
+            MyWorld->Commands.Record(CommandType::ATTACH, this, AddedComponent, AddedComponent->GetHandle());
+        }
+    }
+
+    // Removes the given component from each of this actor's world's tick phase lists.
+    void Actor::RemoveFromWorld(Component *RemovedComponent) {
+        if (MyWorld) {
+            MyWorld->UnregisterTickPhases(RemovedComponent);
+        }
+    }
+
     // TRANSFORM
 
+    // Returns this actor's transform as of its world's previous fixed simulation step.
+    const Transform &Actor::GetPreviousTransform() const {
+        return PreviousTransform;
+    }
+
+    // Returns this actor's transform interpolated between its world's last two fixed simulation steps.
+    // This is the transform this actor is rendered with, and is equal to Transform without a fixed time step.
+    Transform Actor::GetInterpolatedTransform() const {
+        if (!MyWorld || MyWorld->GetInterpolation() >= 1) {
+            return Transform;
+        }
+        return FureyEngine::Transform::Interpolate(PreviousTransform, Transform,
+                                                   static_cast<float>(MyWorld->GetInterpolation()));
+    }
+
     // Returns this actor's world transform.
     Transform Actor::GetTransform() const {
         return Transform;
@@ -126,6 +191,67 @@ namespace FureyEngine {
         // std::cout << "Actor \"" << Name << "\" was destroyed." << std::endl;
     }
 
+    // Automatically called after this pooled actor is destroyed and returned to its pool.
+    // Override this to restore any state that should not carry over when this actor is spawned again.
+    void Actor::Reset() {
+    }
+
+    // Automatically called instead of Spawn() when this pooled actor is spawned again from its pool.
+    // This actor keeps the components it attached when it first spawned, which are attached again.
+    void Actor::Reuse() {
+    }
+
+    // TICK PHASES
+
+    // Returns each phase this actor should tick in once it has started.
+    // Override this to only return the phases this actor overrides so its world can skip it otherwise.
+    // Phases with bound OnTick or OnLateTick events are always included.
+    TickPhase Actor::GetTickPhases() const {
+        return TickPhase::ALL;
+    }
+
+    // Registers this actor with its world again using its current tick phases.
+    // Call this after changing anything that GetTickPhases() or its bound tick events depend on.
+    void Actor::RefreshTickPhases() {
+        if (BeginTick && MyWorld) {
+            MyWorld->RegisterTickPhases(this);
+        }
+    }
+
+    // Returns how often this actor ticks in the variable tick phases once it has started.
+    // Override this to tick less often, or to tick less often while its world considers it nearby or distant.
+    // Call RefreshTickPhases() after changing anything this depends on.
+    TickRate Actor::GetTickRate() const {
+        return {};
+    }
+
+    // SNAPSHOTS
+
+    // Writes this actor's state to the given snapshot.
+    // Override this to save custom state, calling the base method first.
+    // Components are saved separately by the world.
+    void Actor::Save(SnapshotWriter &Writer) const {
+        Writer.Write(Name);
+        Writer.Write(Tag);
+        Writer.Write(Active);
+        Writer.Write(Transform);
+    }
+
+    // Reads this actor's state from the given snapshot in the same order it was saved.
+    // Override this to load custom state, calling the base method first.
+    void Actor::Load(SnapshotReader &Reader) {
+        Reader.Read(Name);
+        Reader.Read(Tag);
+        Reader.Read(Active);
+        Reader.Read(Transform);
+        PreviousTransform = Transform;
+    }
+
+    // Automatically called once this actor and each of its components have been loaded from a snapshot.
+    // Override this to find references to loaded components, calling the base method first.
+    void Actor::PostLoad() {
+    }
+
     // ACTIVITY
 
     // Returns whether this actor is active.
@@ -143,5 +269,5 @@ namespace FureyEngine {
     // STATIC VARIABLE INITIALIZATION
 
     // The total number of actors currently allocated.
-    int Actor::TotalActors;
+    std::atomic<int> Actor::TotalActors = 0;
 }
@@ -5,34 +5,118 @@
 #pragma once
 #include "../Math/Math.h"
 #include "../Components/Component.h"
+#include "../CommandBuffer/CommandBuffer.h"
 
 namespace FureyEngine {
     // Forward declaration of world.
     class World;
 
+    // Forward declaration of actor.
+    class Actor;
+
+    // Forward declaration of actor pool.
+    class ActorPoolBase;
+
+    /**
+     * Allocates a new component of the given type for the given actor using its world's component storage.<br/>
+     * This is defined in World.h once the world class is complete.
+     */
+    template<typename ComponentType, typename... ArgumentTypes>
+    std::shared_ptr<ComponentType> NewComponent(World *OwningWorld, Actor *OwningActor, ArgumentTypes &&... Arguments);
+
     /**
      * Represents a single entity that can be rendered and run code within its world.<br/>
      * Inherit from this class to override scriptable methods and add custom logic.<br/>
      * NOTE: Actors should be constructed within their worlds using World->SpawnActor(...).
      */
     class Actor : public std::enable_shared_from_this<Actor> {
+        // REFERENCE
+
+        /** This actor's handle in the reference registry, which is released after every other member. */
+        ReferenceSlot MySlot;
+
         // WORLD
 
         /** This actor's owning world. */
         Reference<World> MyWorld;
 
         /** The time point this actor was spawned into a world. */
-        const std::chrono::high_resolution_clock::time_point SpawnTimePoint = std::chrono::high_resolution_clock::now();
+        std::chrono::high_resolution_clock::time_point SpawnTimePoint = std::chrono::high_resolution_clock::now();
+
+        /** The order this actor was spawned in relative to every other actor and component in its world. */
+        unsigned long long SpawnOrder = 0;
 
         // ACTIVITY
 
         /** Whether this actor is active and should tick. */
         bool Active = true;
 
+        // TICK PHASES
+
+        /** This actor's index within each of its world's tick phase lists, or -1 if it is not registered. */
+        int TickIndices[TICK_PHASE_COUNT] = {-1, -1, -1, -1};
+
+        /** This actor's tick rate and its progress toward its next tick in each variable tick phase. */
+        TickThrottle Throttle;
+
+        /** This actor's relevance to its world as of the world tick it was last evaluated on. */
+        TickRelevance Relevance = TickRelevance::VISIBLE;
+
+        /** The world tick this actor's relevance was last evaluated on, so its components can share it. */
+        unsigned long long RelevanceTick = ULLONG_MAX;
+
+        // COROUTINES
+
+        /** Whether a coroutine owned by this actor may still be running, so destroying it only searches when needed. */
+        bool OwnsCoroutines = false;
+
+        /** Worlds manage each actor's tick phase indices. */
+        friend class World;
+
+        /** This actor's transform as of its world's previous fixed simulation step. */
+        FureyEngine::Transform PreviousTransform = FureyEngine::Transform();
+
+        /** This actor's position in its world's actor list, or in its pool while it is pooled. */
+        std::list<std::shared_ptr<Actor> >::iterator WorldIterator;
+
+        // POOL
+
+        /** The pool this actor is returned to when destroyed, or nullptr if it is freed instead. */
+        ActorPoolBase *Pool = nullptr;
+
+        /** Whether this actor's spawn events have been called, so a pooled actor is reused rather than spawned again. */
+        bool Spawned = false;
+
+        /** Actor pools mark the actors they allocate. */
+        friend class ActorPoolBase;
+
+        // INDEXES
+
+        /** The first attached component of each component type on this actor. */
+        std::unordered_map<std::type_index, Component *> ComponentsByType;
+
+        /** Replaces or removes the given component in this actor's component type index before it is deleted. */
+        void UnindexComponent(Component *RemovedComponent);
+
+        /** The name this actor was indexed with by its world. */
+        std::string IndexedName;
+
+        /** The tag this actor was indexed with by its world. */
+        std::string IndexedTag;
+
+        /** This actor's position within its world's name, tag and type indexes, or -1 if it is not indexed. */
+        int IndexPositions[3] = {-1, -1, -1};
+
+        /** Queues the given newly attached component to be attached and started by this actor's world. */
+        void AddToWorld(Component *AddedComponent);
+
+        /** Removes the given component from each of this actor's world's tick phase lists. */
+        void RemoveFromWorld(Component *RemovedComponent);
+
         // TOTAL ACTORS
 
         /** The total number of actors currently allocated. */
-        static int TotalActors;
+        static std::atomic<int> TotalActors;
 
     public:
         // ACTOR SETTINGS
@@ -130,42 +214,46 @@ namespace FureyEngine {
         /** Returns this actor's spawn time. */
         [[nodiscard]] std::chrono::high_resolution_clock::time_point SpawnTime() const;
 
+        /**
+         * Returns the order this actor was spawned in relative to every other actor and component in its world.<br/>
+         * Sort by this instead of by address so iteration order is the same each time a world is simulated.
+         */
+        [[nodiscard]] unsigned long long GetSpawnOrder() const;
+
+        /** Returns whether this actor is returned to a pool instead of being freed when destroyed. */
+        [[nodiscard]] bool IsPooled() const;
+
+        // REFERENCE
+
+        /** Returns this actor's handle in the reference registry. */
+        [[nodiscard]] const ReferenceHandle &GetHandle() const;
+
         // COMPONENTS
 
         /** Attaches a new component of the given class to this actor. */
         template<typename ComponentType, typename... ArgumentTypes>
         Reference<ComponentType> AttachComponent(ArgumentTypes... Arguments) {
-            const auto Component = new ComponentType(Arguments...);
-            Components.emplace_back(Component);
+            const auto Component = NewComponent<ComponentType>(MyWorld.Get(), this, std::move(Arguments)...);
+            Components.push_back(Component);
+            Component->ActorIterator = std::prev(Components.end());
+            ComponentsByType.try_emplace(typeid(ComponentType), Component.get());
             Component->SetActor(shared_from_this());
-            return std::dynamic_pointer_cast<ComponentType>(Components.back());
+            AddToWorld(Component.get());
+            return Component;
         }
 
         /** Removes the given component from this actor at the end of the tick, and returns whether it was successfully found. */
         template<typename ComponentType>
         bool RemoveComponent(const ComponentType *RemovedComponent) {
-            if (RemovedComponent == nullptr) {
+            if (RemovedComponent == nullptr || !ReferenceRegistry::IsValid(RemovedComponent->GetHandle()) ||
+                RemovedComponent->GetActor().Get() != this) {
                 return false;
             }
 
-            for (auto &Component: Components) {
-                if (Component.get() == RemovedComponent) {
-                    MyWorld->Cleanup.Bind([&] {
-                        if (Component == nullptr) {
-                            return;
-                        }
-
-                        // Call remove events
-                        Component->Remove();
-                        Component->OnRemove(Component.get());
-
-                        // Delete this component
-                        Components.remove(Component);
-                    });
-                    return true;
-                }
-            }
-            return false;
+            const auto Component = const_cast<FureyEngine::Component *>(
+                static_cast<const FureyEngine::Component *>(RemovedComponent));
+            MyWorld->Commands.Record(CommandType::REMOVE, this, Component, Component->GetHandle());
+            return true;
         }
 
         /**
@@ -180,10 +268,9 @@ namespace FureyEngine {
          */
         template<typename ComponentType>
         [[nodiscard]] Reference<ComponentType> GetComponent() const {
-            for (const auto &Component: Components) {
-                if (Component->Is<ComponentType>()) {
-                    return std::dynamic_pointer_cast<ComponentType>(Component);
-                }
+            const auto Found = ComponentsByType.find(typeid(ComponentType));
+            if (Found != ComponentsByType.end()) {
+                return static_cast<ComponentType *>(Found->second);
             }
             return nullref;
         }
@@ -204,6 +291,15 @@ namespace FureyEngine {
 
         // TRANSFORM
 
+        /** Returns this actor's transform as of its world's previous fixed simulation step. */
+        [[nodiscard]] const FureyEngine::Transform &GetPreviousTransform() const;
+
+        /**
+         * Returns this actor's transform interpolated between its world's last two fixed simulation steps.<br/>
+         * This is the transform this actor is rendered with, and is equal to Transform without a fixed time step.
+         */
+        [[nodiscard]] FureyEngine::Transform GetInterpolatedTransform() const;
+
         /** Returns this actor's world transform. */
         [[nodiscard]] FureyEngine::Transform GetTransform() const;
 
@@ -245,6 +341,61 @@ namespace FureyEngine {
         /** Automatically called after this actor is destroyed. */
         virtual void Destroy();
 
+        /**
+         * Automatically called after this pooled actor is destroyed and returned to its pool.<br/>
+         * Override this to restore any state that should not carry over when this actor is spawned again.
+         */
+        virtual void Reset();
+
+        /**
+         * Automatically called instead of Spawn() when this pooled actor is spawned again from its pool.<br/>
+         * This actor keeps the components it attached when it first spawned, which are attached again.
+         */
+        virtual void Reuse();
+
+        // TICK PHASES
+
+        /**
+         * Returns each phase this actor should tick in once it has started.<br/>
+         * Override this to only return the phases this actor overrides so its world can skip it otherwise.<br/>
+         * Phases with bound OnTick or OnLateTick events are always included.
+         */
+        [[nodiscard]] virtual TickPhase GetTickPhases() const;
+
+        /**
+         * Registers this actor with its world again using its current tick phases.<br/>
+         * Call this after changing anything that GetTickPhases() or its bound tick events depend on.
+         */
+        void RefreshTickPhases();
+
+        /**
+         * Returns how often this actor ticks in the variable tick phases once it has started.<br/>
+         * Override this to tick less often, or to tick less often while its world considers it nearby or distant.<br/>
+         * Call RefreshTickPhases() after changing anything this depends on.
+         */
+        [[nodiscard]] virtual TickRate GetTickRate() const;
+
+        // SNAPSHOTS
+
+        /**
+         * Writes this actor's state to the given snapshot.<br/>
+         * Override this to save custom state, calling the base method first.<br/>
+         * Components are saved separately by the world.
+         */
+        virtual void Save(SnapshotWriter &Writer) const;
+
+        /**
+         * Reads this actor's state from the given snapshot in the same order it was saved.<br/>
+         * Override this to load custom state, calling the base method first.
+         */
+        virtual void Load(SnapshotReader &Reader);
+
+        /**
+         * Automatically called once this actor and each of its components have been loaded from a snapshot.<br/>
+         * Override this to find references to loaded components, calling the base method first.
+         */
+        virtual void PostLoad();
+
         // CASTING
 
         /** Returns whether this actor is the given actor type. */
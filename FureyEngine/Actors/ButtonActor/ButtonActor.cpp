@@ -20,7 +20,7 @@ namespace FureyEngine {
         Actor::Spawn();
 
         // Bind set active to the world's set active function
-        GetWorld()->OnSetActive.Bind(std::bind(ButtonActor::SetActive, this, std::placeholders::_1));
+        GetWorld()->OnSetActive.Bind<&ButtonActor::SetActive>(this);
     }
 
     // Automatically called each world tick.
@@ -200,10 +200,17 @@ namespace FureyEngine {
 
         // Unbind set active from the world's set active function
         if (BeginTick) {
-            GetWorld()->OnSetActive.Unbind(std::bind(ButtonActor::SetActive, this, std::placeholders::_1));
+            GetWorld()->OnSetActive.Unbind<&ButtonActor::SetActive>(this);
         }
     }
 
+    // TICK PHASES
+
+    // Returns each phase this actor should tick in once it has started.
+    TickPhase ButtonActor::GetTickPhases() const {
+        return TickLate ? TickPhase::LATE_TICK : TickPhase::TICK;
+    }
+
     // ACTIVITY
 
     // Sets whether this actor is active.
@@ -73,7 +73,10 @@ namespace FureyEngine {
         /** Whether to click the button when its state is released. */
         bool ClickOnRelease = true;
 
-        /** Whether to use LateTick() instead of Tick(). */
+        /**
+         * Whether to use LateTick() instead of Tick().<br/>
+         * Call RefreshTickPhases() after changing this once this actor has started.
+         */
         bool TickLate = true;
 
         // CONSTRUCTORS
@@ -95,6 +98,11 @@ namespace FureyEngine {
         /** Automatically called after this actor is destroyed. */
         void Destroy() override;
 
+        // TICK PHASES
+
+        /** Returns each phase this actor should tick in once it has started. */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
         // ACTIVITY
 
         /**
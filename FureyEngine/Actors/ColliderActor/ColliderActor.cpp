@@ -12,6 +12,44 @@ namespace FureyEngine {
         : Actor(Name, Active) {
     }
 
+    // TICK PHASES
+
+    // Returns each phase this actor should tick in once it has started.
+    // This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().
+    // Override this in derived actors to only return the phases they tick in.
+    TickPhase ColliderActor::GetTickPhases() const {
+        return typeid(*this) == typeid(ColliderActor) ? TickPhase::NONE : TickPhase::ALL;
+    }
+
+    // SNAPSHOTS
+
+    // Writes this collider's state and whether it has been initialized to the given snapshot.
+    void ColliderActor::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Actor::Save(Writer);
+
+        Writer.Write(Initialized);
+    }
+
+    // Reads this collider's state and whether it has been initialized from the given snapshot.
+    void ColliderActor::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Actor::Load(Reader);
+
+        Reader.Read(Initialized);
+    }
+
+    // Automatically called once this collider and each of its components have been loaded from a snapshot.
+    // This finds this collider's loaded components if it was initialized.
+    void ColliderActor::PostLoad() {
+        // Calls the base class's function
+        Actor::PostLoad();
+
+        if (Initialized) {
+            BrushComponent = GetComponent<FureyEngine::BrushComponent>();
+        }
+    }
+
     // COLLIDER
 
     // Returns whether this collider has been initialized yet.
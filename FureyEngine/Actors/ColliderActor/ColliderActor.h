@@ -25,6 +25,29 @@ namespace FureyEngine {
         /** Constructs a new collider with a name. */
         explicit ColliderActor(const std::string &Name = "Collider", const bool &Active = true);
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this actor should tick in once it has started.<br/>
+         * This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().<br/>
+         * Override this in derived actors to only return the phases they tick in.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // SNAPSHOTS
+
+        /** Writes this collider's state and whether it has been initialized to the given snapshot. */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads this collider's state and whether it has been initialized from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
+
+        /**
+         * Automatically called once this collider and each of its components have been loaded from a snapshot.<br/>
+         * This finds this collider's loaded components if it was initialized.
+         */
+        void PostLoad() override;
+
         // COLLIDER
 
         /** Returns whether this collider has been initialized yet. */
@@ -22,7 +22,7 @@ namespace FureyEngine {
         Actor::Spawn();
 
         // Bind set active to the world's set active function
-        GetWorld()->OnSetActive.Bind(std::bind(ExampleActor::SetActive, this, std::placeholders::_1));
+        GetWorld()->OnSetActive.Bind<&ExampleActor::SetActive>(this);
 
         // New code here
     }
@@ -58,7 +58,7 @@ namespace FureyEngine {
 
         // Unbind set active from the world's set active function
         if (BeginTick) {
-            GetWorld()->OnSetActive.Unbind(std::bind(ExampleActor::SetActive, this, std::placeholders::_1));
+            GetWorld()->OnSetActive.Unbind<&ExampleActor::SetActive>(this);
         }
 
         // New code here
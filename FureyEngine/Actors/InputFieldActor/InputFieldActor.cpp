@@ -159,15 +159,15 @@ namespace FureyEngine {
 
             Input::ClearText();
             Input::StartText();
-            Input::TextEvents.Bind([this](const char &Character, const std::string &String) {
+            TextHandle = Input::TextEvents.Bind([this](const char &Character, const std::string &String) {
                 OnTextChanged(Character, String);
             });
-            Input::MouseButtonEvents[LEFT_MOUSE_BUTTON].Bind([this](auto, const ButtonState &State) {
+            ClickHandle = Input::MouseButtonEvents[LEFT_MOUSE_BUTTON].Bind([this](auto, const ButtonState &State) {
                 if (State == ButtonState::DOWN && IsSelected() && !IsHovered()) {
                     Deselect();
                 }
             });
-            Input::KeyboardEvents[SDLK_RETURN].Bind([this](const ButtonState &State) {
+            ReturnHandle = Input::KeyboardEvents[SDLK_RETURN].Bind([this](const ButtonState &State) {
                 if (State == ButtonState::DOWN && IsSelected()) {
                     Deselect();
                 }
@@ -177,7 +177,7 @@ namespace FureyEngine {
                     Deselect();
                 }
             });*/
-            Input::KeyboardEvents[SDLK_BACKSPACE].Bind([this](const ButtonState &State) {
+            BackspaceHandle = Input::KeyboardEvents[SDLK_BACKSPACE].Bind([this](const ButtonState &State) {
                 if (State == ButtonState::DOWN && TextComponent && IsSelected()) {
                     if (std::string MyText = GetText(); !MyText.empty()) {
                         TextComponent->SetText(MyText.erase(MyText.length() - 1, 1));
@@ -200,16 +200,10 @@ namespace FureyEngine {
             Previous->OnSubmit(Previous->GetText());
 
             Input::StopText();
-            Input::TextEvents.Unbind([Previous](const char &Character, const std::string &String) {
-            });
-            Input::MouseButtonEvents[LEFT_MOUSE_BUTTON].Unbind([Previous](auto, const ButtonState &State) {
-            });
-            Input::KeyboardEvents[SDLK_RETURN].Unbind([Previous](const ButtonState &State) {
-            });
-            /*Input::KeyboardEvents[SDLK_ESCAPE].Unbind([Previous](const ButtonState &State) {
-            });*/
-            Input::KeyboardEvents[SDLK_BACKSPACE].Unbind([Previous](const ButtonState &State) {
-            });
+            Input::TextEvents.Unbind(TextHandle);
+            Input::MouseButtonEvents[LEFT_MOUSE_BUTTON].Unbind(ClickHandle);
+            Input::KeyboardEvents[SDLK_RETURN].Unbind(ReturnHandle);
+            Input::KeyboardEvents[SDLK_BACKSPACE].Unbind(BackspaceHandle);
         }
 
         SelectedTextField = nullref;
@@ -286,4 +280,16 @@ namespace FureyEngine {
 
     // The currently selected input field.
     Reference<InputFieldActor> InputFieldActor::SelectedTextField = nullref;
+
+    // The handle of the selected input field's text event.
+    DelegateHandle InputFieldActor::TextHandle = 0;
+
+    // The handle of the selected input field's left mouse button event.
+    DelegateHandle InputFieldActor::ClickHandle = 0;
+
+    // The handle of the selected input field's return key event.
+    DelegateHandle InputFieldActor::ReturnHandle = 0;
+
+    // The handle of the selected input field's backspace key event.
+    DelegateHandle InputFieldActor::BackspaceHandle = 0;
 }
@@ -14,6 +14,18 @@ namespace FureyEngine {
         /** The currently selected input field. */
         static Reference<InputFieldActor> SelectedTextField;
 
+        /** The handle of the selected input field's text event. */
+        static DelegateHandle TextHandle;
+
+        /** The handle of the selected input field's left mouse button event. */
+        static DelegateHandle ClickHandle;
+
+        /** The handle of the selected input field's return key event. */
+        static DelegateHandle ReturnHandle;
+
+        /** The handle of the selected input field's backspace key event. */
+        static DelegateHandle BackspaceHandle;
+
         /** Normalizes the given string to allow it to fit within this input field. */
         virtual std::string NormalizeString(const std::string &String) const;
 
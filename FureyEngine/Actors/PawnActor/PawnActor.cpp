@@ -12,6 +12,49 @@ namespace FureyEngine {
         : Actor(Name, Active) {
     }
 
+    // TICK PHASES
+
+    // Returns each phase this actor should tick in once it has started.
+    // This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().
+    // Override this in derived actors to only return the phases they tick in.
+    TickPhase PawnActor::GetTickPhases() const {
+        return typeid(*this) == typeid(PawnActor) ? TickPhase::NONE : TickPhase::ALL;
+    }
+
+    // SNAPSHOTS
+
+    // Writes this player pawn's state and whether it has been initialized to the given snapshot.
+    void PawnActor::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Actor::Save(Writer);
+
+        Writer.Write(Initialized);
+    }
+
+    // Reads this player pawn's state and whether it has been initialized from the given snapshot.
+    void PawnActor::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Actor::Load(Reader);
+
+        Reader.Read(Initialized);
+    }
+
+    // Automatically called once this player pawn and each of its components have been loaded from a snapshot.
+    // This finds this player pawn's loaded components if it was initialized.
+    void PawnActor::PostLoad() {
+        // Calls the base class's function
+        Actor::PostLoad();
+
+        if (Initialized) {
+            RenderComponent = GetComponent<FureyEngine::RenderComponent>();
+            AnimationComponent = GetComponent<FureyEngine::AnimationComponent>();
+            CameraComponent = GetComponent<FureyEngine::CameraComponent>();
+            BrushComponent = GetComponent<FureyEngine::BrushComponent>();
+            MovementComponent = GetComponent<FureyEngine::MovementComponent>();
+            PhysicsComponent = GetComponent<FureyEngine::PhysicsComponent>();
+        }
+    }
+
     // PAWN
 
     // Returns whether this player pawn has been initialized yet.
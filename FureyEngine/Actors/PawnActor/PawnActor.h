@@ -60,6 +60,29 @@ namespace FureyEngine {
         /** Constructs a new player pawn with a name. */
         explicit PawnActor(const std::string &Name = "Player", const bool &Active = true);
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this actor should tick in once it has started.<br/>
+         * This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().<br/>
+         * Override this in derived actors to only return the phases they tick in.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // SNAPSHOTS
+
+        /** Writes this player pawn's state and whether it has been initialized to the given snapshot. */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads this player pawn's state and whether it has been initialized from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
+
+        /**
+         * Automatically called once this player pawn and each of its components have been loaded from a snapshot.<br/>
+         * This finds this player pawn's loaded components if it was initialized.
+         */
+        void PostLoad() override;
+
         // PAWN
 
         /** Returns whether this player pawn has been initialized yet. */
@@ -12,6 +12,47 @@ namespace FureyEngine {
         : Actor(Name, Active) {
     }
 
+    // TICK PHASES
+
+    // Returns each phase this actor should tick in once it has started.
+    // This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().
+    // Override this in derived actors to only return the phases they tick in.
+    TickPhase SpriteActor::GetTickPhases() const {
+        return typeid(*this) == typeid(SpriteActor) ? TickPhase::NONE : TickPhase::ALL;
+    }
+
+    // SNAPSHOTS
+
+    // Writes this sprite's state and whether it has been initialized to the given snapshot.
+    void SpriteActor::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Actor::Save(Writer);
+
+        Writer.Write(Initialized);
+    }
+
+    // Reads this sprite's state and whether it has been initialized from the given snapshot.
+    void SpriteActor::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Actor::Load(Reader);
+
+        Reader.Read(Initialized);
+    }
+
+    // Automatically called once this sprite and each of its components have been loaded from a snapshot.
+    // This finds this sprite's loaded components if it was initialized.
+    void SpriteActor::PostLoad() {
+        // Calls the base class's function
+        Actor::PostLoad();
+
+        if (Initialized) {
+            RenderComponent = GetComponent<FureyEngine::RenderComponent>();
+            AnimationComponent = GetComponent<FureyEngine::AnimationComponent>();
+            BrushComponent = GetComponent<FureyEngine::BrushComponent>();
+            PhysicsComponent = GetComponent<FureyEngine::PhysicsComponent>();
+        }
+    }
+
     // SPRITE
 
     // Returns whether this sprite has been initialized yet.
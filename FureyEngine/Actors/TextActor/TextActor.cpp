@@ -12,6 +12,44 @@ namespace FureyEngine {
         : Actor(Name, Active) {
     }
 
+    // TICK PHASES
+
+    // Returns each phase this actor should tick in once it has started.
+    // This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().
+    // Override this in derived actors to only return the phases they tick in.
+    TickPhase TextActor::GetTickPhases() const {
+        return typeid(*this) == typeid(TextActor) ? TickPhase::NONE : TickPhase::ALL;
+    }
+
+    // SNAPSHOTS
+
+    // Writes this text actor's state and whether it has been initialized to the given snapshot.
+    void TextActor::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Actor::Save(Writer);
+
+        Writer.Write(Initialized);
+    }
+
+    // Reads this text actor's state and whether it has been initialized from the given snapshot.
+    void TextActor::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Actor::Load(Reader);
+
+        Reader.Read(Initialized);
+    }
+
+    // Automatically called once this text actor and each of its components have been loaded from a snapshot.
+    // This finds this text actor's loaded components if it was initialized.
+    void TextActor::PostLoad() {
+        // Calls the base class's function
+        Actor::PostLoad();
+
+        if (Initialized) {
+            TextComponent = GetComponent<FureyEngine::TextComponent>();
+        }
+    }
+
     // TEXT
 
     // Returns whether this text has been initialized yet.
@@ -28,6 +28,29 @@ namespace FureyEngine {
         /** Constructs new text with a name. */
         explicit TextActor(const std::string &Name = "Text", const bool &Active = true);
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this actor should tick in once it has started.<br/>
+         * This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().<br/>
+         * Override this in derived actors to only return the phases they tick in.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // SNAPSHOTS
+
+        /** Writes this text actor's state and whether it has been initialized to the given snapshot. */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads this text actor's state and whether it has been initialized from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
+
+        /**
+         * Automatically called once this text actor and each of its components have been loaded from a snapshot.<br/>
+         * This finds this text actor's loaded components if it was initialized.
+         */
+        void PostLoad() override;
+
         // TEXT
 
         /** Returns whether this text has been initialized yet. */
@@ -12,6 +12,32 @@ namespace FureyEngine {
         : ColliderActor(Name, Active) {
     }
 
+    // TICK PHASES
+
+    // Returns each phase this actor should tick in once it has started.
+    // This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().
+    // Override this in derived actors to only return the phases they tick in.
+    TickPhase TriggerActor::GetTickPhases() const {
+        return typeid(*this) == typeid(TriggerActor) ? TickPhase::NONE : TickPhase::ALL;
+    }
+
+    // SNAPSHOTS
+
+    // Automatically called once this trigger box and each of its components have been loaded from a snapshot.
+    // This binds this trigger box's collision events to its loaded brush component.
+    void TriggerActor::PostLoad() {
+        // Calls the base class's function
+        ColliderActor::PostLoad();
+
+        if (Initialized && BrushComponent) {
+            BrushComponent->OnCollision.Bind(
+                [this](const FureyEngine::BrushComponent *MyBrushComponent,
+                       FureyEngine::BrushComponent *OtherBrushComponent) {
+                    OnCollision(MyBrushComponent, OtherBrushComponent);
+                });
+        }
+    }
+
     // TRIGGER
 
     // A function used to dispatch trigger collision events.
@@ -20,9 +46,11 @@ namespace FureyEngine {
         if (MyBrushComponent->CollisionStateWith(OtherBrushComponent) ==
             BrushComponent::CollisionState::COLLISION_ENTER) {
             OnTriggerEnter(this, OtherBrushComponent);
+            GetWorld()->Bus.Publish(TriggerEnterEvent{OtherBrushComponent}, this, MyBrushComponent->Layer);
         } else if (MyBrushComponent->CollisionStateWith(OtherBrushComponent) ==
                    BrushComponent::CollisionState::COLLISION_EXIT) {
             OnTriggerExit(this, OtherBrushComponent);
+            GetWorld()->Bus.Publish(TriggerExitEvent{OtherBrushComponent}, this, MyBrushComponent->Layer);
         }
     }
 
@@ -6,6 +6,24 @@
 #include "../ColliderActor/ColliderActor.h"
 
 namespace FureyEngine {
+    /**
+     * Published to the world's event bus when a brush component enters a trigger box.<br/>
+     * The sender is the trigger box, and the layer is the trigger box's collision layer.
+     */
+    struct TriggerEnterEvent final {
+        /** The brush component that entered the trigger box. */
+        Reference<BrushComponent> Other;
+    };
+
+    /**
+     * Published to the world's event bus when a brush component is no longer inside a trigger box.<br/>
+     * The sender is the trigger box, and the layer is the trigger box's collision layer.
+     */
+    struct TriggerExitEvent final {
+        /** The brush component that left the trigger box. */
+        Reference<BrushComponent> Other;
+    };
+
     /** An actor with a brush component used for triggers. */
     class TriggerActor : public ColliderActor {
     protected:
@@ -37,6 +55,23 @@ namespace FureyEngine {
         /** Constructs a new trigger box with a name. */
         explicit TriggerActor(const std::string &Name = "Trigger", const bool &Active = true);
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this actor should tick in once it has started.<br/>
+         * This actor does not tick, but derived actors tick in every phase in case they override Tick() or LateTick().<br/>
+         * Override this in derived actors to only return the phases they tick in.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // SNAPSHOTS
+
+        /**
+         * Automatically called once this trigger box and each of its components have been loaded from a snapshot.<br/>
+         * This binds this trigger box's collision events to its loaded brush component.
+         */
+        void PostLoad() override;
+
         // TRIGGER
 
         /** Initializes this trigger box with the given transform. */
@@ -0,0 +1,465 @@
+// .cpp
+// Allocation Tracker Script
+// by Kyle Furey
+
+#include "AllocationTracker.h"
+#include "../Profiler/Profiler.h"
+
+namespace FureyEngine {
+    // STATISTICS
+
+    // Adds the given stats to these stats.
+    AllocationTracker::AllocationStats &AllocationTracker::AllocationStats::operator+=(const AllocationStats &Other) {
+        Allocations += Other.Allocations;
+        Frees += Other.Frees;
+        BytesAllocated += Other.BytesAllocated;
+        BytesFreed += Other.BytesFreed;
+        return *this;
+    }
+
+    // Returns these stats minus the given stats.
+    AllocationTracker::AllocationStats AllocationTracker::AllocationStats::operator-(
+        const AllocationStats &Other) const {
+        return {
+            Allocations - Other.Allocations,
+            Frees - Other.Frees,
+            BytesAllocated - Other.BytesAllocated,
+            BytesFreed - Other.BytesFreed
+        };
+    }
+
+    // COUNTERS
+
+    // Returns this thread's table, creating it when this thread first counts an allocation.
+    AllocationTracker::ThreadTable &AllocationTracker::CurrentTable() {
+        // Each thread returns its table to be reused once it exits
+        thread_local const struct TableOwner final {
+            ThreadTable *Table;
+
+            TableOwner() {
+                std::lock_guard Lock(Mutex);
+                if (!FreeTables.empty()) {
+                    Table = FreeTables.back();
+                    FreeTables.pop_back();
+                } else {
+                    Table = Tables.emplace_back(std::make_unique<ThreadTable>()).get();
+                    Table->Scopes.back().Name.store(ALLOCATION_TRACKER_OVERFLOW, std::memory_order_release);
+                }
+            }
+
+            ~TableOwner() {
+                // Memory freed after this thread's table is returned is never counted
+                Counting = true;
+                std::lock_guard Lock(Mutex);
+                FreeTables.push_back(Table);
+            }
+        } Owner;
+        return *Owner.Table;
+    }
+
+    // Returns the total counted under each scope name across every thread.
+    std::unordered_map<const char *, AllocationTracker::AllocationStats> AllocationTracker::CountTotals() {
+        std::unordered_map<const char *, AllocationStats> Totals;
+        std::lock_guard Lock(Mutex);
+        for (const auto &Table: Tables) {
+            for (const auto &Scope: Table->Scopes) {
+                const char *const Name = Scope.Name.load(std::memory_order_acquire);
+                if (Name == nullptr) {
+                    continue;
+                }
+                Totals[Name] += {
+                    Scope.Allocations.load(std::memory_order_relaxed),
+                    Scope.Frees.load(std::memory_order_relaxed),
+                    Scope.BytesAllocated.load(std::memory_order_relaxed),
+                    Scope.BytesFreed.load(std::memory_order_relaxed)
+                };
+            }
+        }
+        return Totals;
+    }
+
+    // Counts an allocation or free of the given size under this thread's innermost scope.
+    void AllocationTracker::Count(const size_t &Size, const bool &Allocated) {
+        if (Counting || !Tracking.load(std::memory_order_relaxed)) {
+            return;
+        }
+        Counting = true;
+        ThreadTable &Table = CurrentTable();
+
+        // Find this scope's slot by the address of its name, claiming an unused slot the first time
+        const char *Name = AllocationScope::Current();
+        if (Name == nullptr) {
+            Name = ALLOCATION_TRACKER_UNSCOPED;
+        }
+        ScopeCounters *Counters = &Table.Scopes.back();
+        const size_t Hash = reinterpret_cast<uintptr_t>(Name) * 11400714819323198485ULL >> 20;
+        for (size_t i = 0; i < ALLOCATION_TRACKER_SCOPES; ++i) {
+            ScopeCounters &Slot = Table.Scopes[(Hash + i) % ALLOCATION_TRACKER_SCOPES];
+            const char *const SlotName = Slot.Name.load(std::memory_order_relaxed);
+            if (SlotName == Name) {
+                Counters = &Slot;
+                break;
+            }
+            if (SlotName == nullptr) {
+                Slot.Name.store(Name, std::memory_order_release);
+                Counters = &Slot;
+                break;
+            }
+        }
+
+        // Only this thread writes its counters, so they are incremented without locking
+        const auto Increment = [](std::atomic<unsigned long long> &Counter, const unsigned long long &Amount) {
+            Counter.store(Counter.load(std::memory_order_relaxed) + Amount, std::memory_order_relaxed);
+        };
+        if (Allocated) {
+            Increment(Counters->Allocations, 1);
+            Increment(Counters->BytesAllocated, Size);
+        } else {
+            Increment(Counters->Frees, 1);
+            Increment(Counters->BytesFreed, Size);
+        }
+        Counting = false;
+    }
+
+    // Appends the given stats to the given JSON as an object.
+    void AllocationTracker::AppendStats(std::string &Json, const AllocationStats &Stats) {
+        char Numbers[160];
+        std::snprintf(Numbers, sizeof(Numbers),
+                      "{\"allocations\":%llu,\"frees\":%llu,\"bytes_allocated\":%llu,\"bytes_freed\":%llu}",
+                      Stats.Allocations, Stats.Frees, Stats.BytesAllocated, Stats.BytesFreed);
+        Json += Numbers;
+    }
+
+    // TRACKING
+
+    // Starts counting allocations.
+    void AllocationTracker::Start() {
+        if (IsTracking()) {
+            return;
+        }
+        const bool WasCounting = std::exchange(Counting, true);
+        PreviousTotals = CountTotals();
+        Counting = WasCounting;
+        Tracking.store(true, std::memory_order_relaxed);
+    }
+
+    // Stops counting allocations, keeping each frame's stats.
+    void AllocationTracker::Stop() {
+        Tracking.store(false, std::memory_order_relaxed);
+    }
+
+    // Returns whether allocations are being counted.
+    bool AllocationTracker::IsTracking() {
+        return Tracking.load(std::memory_order_relaxed);
+    }
+
+    // ALLOCATION
+
+    // Allocates and counts the given number of bytes with the given alignment.
+    // Returns nullptr if the allocation failed and it should not throw.
+    // NOTE: This is called by the global operator new while TRACK_ALLOCATIONS is enabled.
+    void *AllocationTracker::Allocate(const size_t &Size, const size_t &Alignment, const bool &Throw) {
+        // Leave room for the header and for aligning past it
+        const size_t Aligned = std::max(Alignment, alignof(AllocationHeader));
+        void *const Allocation = std::malloc(Size + sizeof(AllocationHeader) + Aligned);
+        if (Allocation == nullptr) {
+            if (Throw) {
+                throw std::bad_alloc();
+            }
+            return nullptr;
+        }
+
+        const uintptr_t Address = (reinterpret_cast<uintptr_t>(Allocation) + sizeof(AllocationHeader) + Aligned - 1) /
+                                  Aligned * Aligned;
+        void *const Pointer = reinterpret_cast<void *>(Address);
+        *(static_cast<AllocationHeader *>(Pointer) - 1) = {Size, Allocation};
+        Count(Size, true);
+        return Pointer;
+    }
+
+    // Frees and counts memory allocated with Allocate().
+    // NOTE: This is called by the global operator delete while TRACK_ALLOCATIONS is enabled.
+    void AllocationTracker::Free(void *Pointer) {
+        if (Pointer == nullptr) {
+            return;
+        }
+        const AllocationHeader Header = *(static_cast<AllocationHeader *>(Pointer) - 1);
+        Count(Header.Size, false);
+        std::free(Header.Allocation);
+    }
+
+    // FRAMES
+
+    // Ends the current frame, storing what each scope allocated and freed during it.
+    // This is called at the end of each engine loop, and should be called between updates.
+    void AllocationTracker::EndFrame() {
+        if (!IsTracking()) {
+            return;
+        }
+        const bool WasCounting = std::exchange(Counting, true);
+
+        // Subtract the previous frame's totals from each scope's totals, merging scopes with the same name
+        auto Totals = CountTotals();
+        FrameStats.clear();
+        for (const auto &[Name, Total]: Totals) {
+            const auto Previous = PreviousTotals.find(Name);
+            const AllocationStats Counted = Previous != PreviousTotals.end() ? Total - Previous->second : Total;
+            if (Counted.Allocations == 0 && Counted.Frees == 0) {
+                continue;
+            }
+            auto ScopeName = ScopeNames.find(Name);
+            if (ScopeName == ScopeNames.end()) {
+                ScopeName = ScopeNames.emplace(Name, Profiler::ZoneName(Name)).first;
+            }
+            FrameStats[ScopeName->second] += Counted;
+        }
+        PreviousTotals = std::move(Totals);
+
+        // Accumulate this frame into each scope's totals
+        for (const auto &[Name, Counted]: FrameStats) {
+            TotalStats[Name] += Counted;
+            auto &Peak = PeakAllocations[Name];
+            Peak = std::max(Peak, Counted.Allocations);
+        }
+        ++EndedFrames;
+
+        Counting = WasCounting;
+    }
+
+    // Returns the stats of each scope during the previous frame.
+    std::map<std::string, AllocationTracker::AllocationStats> AllocationTracker::LastFrame() {
+        return FrameStats;
+    }
+
+    // Returns the total stats of every scope during the previous frame.
+    AllocationTracker::AllocationStats AllocationTracker::LastFrameTotal() {
+        AllocationStats Total;
+        for (const auto &[Name, Counted]: FrameStats) {
+            Total += Counted;
+        }
+        return Total;
+    }
+
+    // Returns the stats of each scope across each frame since tracking started.
+    std::map<std::string, AllocationTracker::AllocationStats> AllocationTracker::Totals() {
+        return TotalStats;
+    }
+
+    // Returns the number of frames ended since tracking started.
+    unsigned long long AllocationTracker::Frames() {
+        return EndedFrames;
+    }
+
+    // EXPORT
+
+    // Returns each scope's stats as JSON, sorted by the number of allocations.
+    std::string AllocationTracker::ToJson() {
+        const bool WasCounting = std::exchange(Counting, true);
+
+        std::vector<const std::pair<const std::string, AllocationStats> *> Sorted;
+        Sorted.reserve(TotalStats.size());
+        for (const auto &Scope: TotalStats) {
+            Sorted.push_back(&Scope);
+        }
+        std::stable_sort(Sorted.begin(), Sorted.end(), [](const auto *Left, const auto *Right) {
+            return Left->second.Allocations > Right->second.Allocations;
+        });
+
+        std::string Json = "{\"frames\":" + std::to_string(EndedFrames) + ",\n\"last_frame\":";
+        AppendStats(Json, LastFrameTotal());
+        Json += ",\n\"scopes\":[";
+        bool First = true;
+        for (const auto *Scope: Sorted) {
+            Json += First ? "\n{\"name\":" : ",\n{\"name\":";
+            First = false;
+            Profiler::AppendString(Json, Scope->first);
+            Json += ",\"total\":";
+            AppendStats(Json, Scope->second);
+            Json += ",\"last_frame\":";
+            const auto LastFrameStats = FrameStats.find(Scope->first);
+            AppendStats(Json, LastFrameStats != FrameStats.end() ? LastFrameStats->second : AllocationStats());
+            Json += ",\"allocations_per_frame\":";
+            char Number[32];
+            std::snprintf(Number, sizeof(Number), "%.3f",
+                          EndedFrames > 0
+                              ? static_cast<double>(Scope->second.Allocations) / static_cast<double>(EndedFrames)
+                              : 0.0);
+            Json += Number;
+            Json += ",\"peak_frame_allocations\":" + std::to_string(PeakAllocations[Scope->first]) + "}";
+        }
+        Json += "\n]}\n";
+
+        Counting = WasCounting;
+        return Json;
+    }
+
+    // Writes each scope's stats to the given file as JSON, sorted by the number of allocations.
+    void AllocationTracker::ExportJson(const std::string &Path) {
+        std::ofstream File(Path, std::ios::binary);
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to open allocation report file \"" + Path + "\" for writing!");
+        }
+        const std::string Json = ToJson();
+        File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to write allocation report file \"" + Path + "\"!");
+        }
+    }
+
+    // CLEAR
+
+    // Discards each frame's stats.
+    void AllocationTracker::Clear() {
+        const bool WasCounting = std::exchange(Counting, true);
+        PreviousTotals = CountTotals();
+        FrameStats.clear();
+        TotalStats.clear();
+        PeakAllocations.clear();
+        EndedFrames = 0;
+        Counting = WasCounting;
+    }
+
+    // STATIC VARIABLE INITIALIZATION
+
+    // Guards the list of tables, which is only locked once by each thread and when ending a frame.
+    std::mutex AllocationTracker::Mutex;
+
+    // Each thread's table.
+    std::vector<std::unique_ptr<AllocationTracker::ThreadTable> > AllocationTracker::Tables;
+
+    // Each table whose thread has exited.
+    std::vector<AllocationTracker::ThreadTable *> AllocationTracker::FreeTables;
+
+    // Whether allocations are being counted.
+    std::atomic<bool> AllocationTracker::Tracking = false;
+
+    // Whether this thread is inside the tracker, whose own allocations are never counted.
+    thread_local bool AllocationTracker::Counting = false;
+
+    // The total counted under each scope name as of the end of the previous frame.
+    std::unordered_map<const char *, AllocationTracker::AllocationStats> AllocationTracker::PreviousTotals;
+
+    // The readable name of each scope name.
+    std::unordered_map<const char *, std::string> AllocationTracker::ScopeNames;
+
+    // The stats of each scope during the previous frame.
+    std::map<std::string, AllocationTracker::AllocationStats> AllocationTracker::FrameStats;
+
+    // The stats of each scope across each frame since tracking started.
+    std::map<std::string, AllocationTracker::AllocationStats> AllocationTracker::TotalStats;
+
+    // The most allocations each scope made in a single frame since tracking started.
+    std::map<std::string, unsigned long long> AllocationTracker::PeakAllocations;
+
+    // The number of frames ended since tracking started.
+    unsigned long long AllocationTracker::EndedFrames = 0;
+
+    // ALLOCATION SCOPE
+
+    // Counts allocations on this thread under the given name.
+    AllocationScope::AllocationScope(const char *Name)
+        : PreviousName(CurrentName) {
+        CurrentName = Name;
+    }
+
+    // Counts allocations under the previous scope again.
+    AllocationScope::~AllocationScope() {
+        CurrentName = PreviousName;
+    }
+
+    // Returns the name of this thread's innermost scope, or nullptr if there is none.
+    const char *AllocationScope::Current() {
+        return CurrentName;
+    }
+
+    // The name of this thread's innermost scope, or nullptr if there is none.
+    thread_local const char *AllocationScope::CurrentName = nullptr;
+}
+
+#if TRACK_ALLOCATIONS
+// GLOBAL ALLOCATION
+
+// Each global allocation is counted by the allocation tracker.
+
+void *operator new(const size_t Size) {
+    return FureyEngine::AllocationTracker::Allocate(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, true);
+}
+
+void *operator new[](const size_t Size) {
+    return FureyEngine::AllocationTracker::Allocate(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, true);
+}
+
+void *operator new(const size_t Size, const std::nothrow_t &) noexcept {
+    return FureyEngine::AllocationTracker::Allocate(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, false);
+}
+
+void *operator new[](const size_t Size, const std::nothrow_t &) noexcept {
+    return FureyEngine::AllocationTracker::Allocate(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, false);
+}
+
+void *operator new(const size_t Size, const std::align_val_t Alignment) {
+    return FureyEngine::AllocationTracker::Allocate(Size, static_cast<size_t>(Alignment), true);
+}
+
+void *operator new[](const size_t Size, const std::align_val_t Alignment) {
+    return FureyEngine::AllocationTracker::Allocate(Size, static_cast<size_t>(Alignment), true);
+}
+
+void *operator new(const size_t Size, const std::align_val_t Alignment, const std::nothrow_t &) noexcept {
+    return FureyEngine::AllocationTracker::Allocate(Size, static_cast<size_t>(Alignment), false);
+}
+
+void *operator new[](const size_t Size, const std::align_val_t Alignment, const std::nothrow_t &) noexcept {
+    return FureyEngine::AllocationTracker::Allocate(Size, static_cast<size_t>(Alignment), false);
+}
+
+// Each global free is counted by the allocation tracker.
+
+void operator delete(void *Pointer) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete[](void *Pointer) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete(void *Pointer, size_t) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete[](void *Pointer, size_t) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete(void *Pointer, const std::nothrow_t &) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete[](void *Pointer, const std::nothrow_t &) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete(void *Pointer, std::align_val_t) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete[](void *Pointer, std::align_val_t) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete(void *Pointer, size_t, std::align_val_t) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete[](void *Pointer, size_t, std::align_val_t) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete(void *Pointer, std::align_val_t, const std::nothrow_t &) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+
+void operator delete[](void *Pointer, std::align_val_t, const std::nothrow_t &) noexcept {
+    FureyEngine::AllocationTracker::Free(Pointer);
+}
+#endif
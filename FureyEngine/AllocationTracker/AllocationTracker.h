@@ -0,0 +1,241 @@
+// .h
+// Allocation Tracker Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+
+// The number of distinct scopes each thread can count allocations for before they are counted together.
+#define ALLOCATION_TRACKER_SCOPES 1024
+
+// The name of the scope allocations are counted under outside of any scope.
+#define ALLOCATION_TRACKER_UNSCOPED "Unscoped"
+
+// The name of the scope allocations are counted under once a thread has counted too many scopes.
+#define ALLOCATION_TRACKER_OVERFLOW "Other"
+
+namespace FureyEngine {
+    /**
+     * A static class that counts the allocations, frees and bytes of each frame while TRACK_ALLOCATIONS is enabled.<br/>
+     * TRACK_ALLOCATIONS replaces the global operator new and delete, so every allocation in the program is counted.<br/>
+     * Each allocation and free is counted under the innermost profiled zone (PROFILE_ZONE()) of the thread it is on.<br/>
+     * Zones are scoped even when PROFILING is disabled, so Input::Update, World::Update, BrushComponent::Collision,
+     * Renderer::Render and Engine::Cleanup are each counted separately.<br/>
+     * Each thread counts into its own table without locking.
+     */
+    class AllocationTracker final {
+        // ABSTRACT CLASS
+
+        /** Prevents instantiation of this class. */
+        virtual void Abstract() = 0;
+
+    public:
+        // STATISTICS
+
+        /** The allocations and frees counted under a scope. */
+        struct AllocationStats final {
+            /** The number of allocations. */
+            unsigned long long Allocations = 0;
+
+            /** The number of frees. */
+            unsigned long long Frees = 0;
+
+            /** The number of bytes allocated. */
+            unsigned long long BytesAllocated = 0;
+
+            /** The number of bytes freed. */
+            unsigned long long BytesFreed = 0;
+
+            /** Adds the given stats to these stats. */
+            AllocationStats &operator+=(const AllocationStats &Other);
+
+            /** Returns these stats minus the given stats. */
+            [[nodiscard]] AllocationStats operator-(const AllocationStats &Other) const;
+        };
+
+    private:
+        // COUNTERS
+
+        /** The counters of one scope on one thread, which are only written by their thread. */
+        struct ScopeCounters final {
+            /** The name of this scope, or nullptr if this slot is unused. */
+            std::atomic<const char *> Name = nullptr;
+
+            /** The number of allocations. */
+            std::atomic<unsigned long long> Allocations = 0;
+
+            /** The number of frees. */
+            std::atomic<unsigned long long> Frees = 0;
+
+            /** The number of bytes allocated. */
+            std::atomic<unsigned long long> BytesAllocated = 0;
+
+            /** The number of bytes freed. */
+            std::atomic<unsigned long long> BytesFreed = 0;
+        };
+
+        /** The counters of each scope on one thread, which is reused by a new thread once its thread exits. */
+        struct ThreadTable final {
+            /** Each scope's counters, indexed by the address of its name, with the last slot for overflow. */
+            std::array<ScopeCounters, ALLOCATION_TRACKER_SCOPES + 1> Scopes;
+        };
+
+        /** The size of an allocation and the address it was allocated at, stored just before the allocation. */
+        struct AllocationHeader final {
+            /** The number of bytes requested. */
+            size_t Size;
+
+            /** The address returned by malloc(). */
+            void *Allocation;
+        };
+
+        /** Guards the list of tables, which is only locked once by each thread and when ending a frame. */
+        static std::mutex Mutex;
+
+        /** Each thread's table. */
+        static std::vector<std::unique_ptr<ThreadTable> > Tables;
+
+        /** Each table whose thread has exited. */
+        static std::vector<ThreadTable *> FreeTables;
+
+        /** Whether allocations are being counted. */
+        static std::atomic<bool> Tracking;
+
+        /** Whether this thread is inside the tracker, whose own allocations are never counted. */
+        static thread_local bool Counting;
+
+        // FRAMES
+
+        /** The total counted under each scope name as of the end of the previous frame. */
+        static std::unordered_map<const char *, AllocationStats> PreviousTotals;
+
+        /** The readable name of each scope name. */
+        static std::unordered_map<const char *, std::string> ScopeNames;
+
+        /** The stats of each scope during the previous frame. */
+        static std::map<std::string, AllocationStats> FrameStats;
+
+        /** The stats of each scope across each frame since tracking started. */
+        static std::map<std::string, AllocationStats> TotalStats;
+
+        /** The most allocations each scope made in a single frame since tracking started. */
+        static std::map<std::string, unsigned long long> PeakAllocations;
+
+        /** The number of frames ended since tracking started. */
+        static unsigned long long EndedFrames;
+
+        /** Returns this thread's table, creating it when this thread first counts an allocation. */
+        [[nodiscard]] static ThreadTable &CurrentTable();
+
+        /** Returns the total counted under each scope name across every thread. */
+        [[nodiscard]] static std::unordered_map<const char *, AllocationStats> CountTotals();
+
+        /** Counts an allocation or free of the given size under this thread's innermost scope. */
+        static void Count(const size_t &Size, const bool &Allocated);
+
+        /** Appends the given stats to the given JSON as an object. */
+        static void AppendStats(std::string &Json, const AllocationStats &Stats);
+
+    public:
+        // TRACKING
+
+        /** Starts counting allocations. */
+        static void Start();
+
+        /** Stops counting allocations, keeping each frame's stats. */
+        static void Stop();
+
+        /** Returns whether allocations are being counted. */
+        [[nodiscard]] static bool IsTracking();
+
+        // ALLOCATION
+
+        /**
+         * Allocates and counts the given number of bytes with the given alignment.<br/>
+         * Returns nullptr if the allocation failed and it should not throw.<br/>
+         * NOTE: This is called by the global operator new while TRACK_ALLOCATIONS is enabled.
+         */
+        [[nodiscard]] static void *Allocate(const size_t &Size, const size_t &Alignment, const bool &Throw);
+
+        /**
+         * Frees and counts memory allocated with Allocate().<br/>
+         * NOTE: This is called by the global operator delete while TRACK_ALLOCATIONS is enabled.
+         */
+        static void Free(void *Pointer);
+
+        // FRAMES
+
+        /**
+         * Ends the current frame, storing what each scope allocated and freed during it.<br/>
+         * This is called at the end of each engine loop, and should be called between updates.
+         */
+        static void EndFrame();
+
+        /** Returns the stats of each scope during the previous frame. */
+        [[nodiscard]] static std::map<std::string, AllocationStats> LastFrame();
+
+        /** Returns the total stats of every scope during the previous frame. */
+        [[nodiscard]] static AllocationStats LastFrameTotal();
+
+        /** Returns the stats of each scope across each frame since tracking started. */
+        [[nodiscard]] static std::map<std::string, AllocationStats> Totals();
+
+        /** Returns the number of frames ended since tracking started. */
+        [[nodiscard]] static unsigned long long Frames();
+
+        // EXPORT
+
+        /** Returns each scope's stats as JSON, sorted by the number of allocations. */
+        [[nodiscard]] static std::string ToJson();
+
+        /** Writes each scope's stats to the given file as JSON, sorted by the number of allocations. */
+        static void ExportJson(const std::string &Path);
+
+        // CLEAR
+
+        /** Discards each frame's stats. */
+        static void Clear();
+    };
+
+    /**
+     * Counts allocations on this thread under the given name until it is destroyed.<br/>
+     * Use PROFILE_ZONE() instead of this, which scopes allocations while TRACK_ALLOCATIONS is enabled.
+     */
+    class AllocationScope final {
+        /** The name of this thread's innermost scope, or nullptr if there is none. */
+        static thread_local const char *CurrentName;
+
+        /** The name of the scope that was active before this scope. */
+        const char *PreviousName;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Counts allocations on this thread under the given name. */
+        explicit AllocationScope(const char *Name);
+
+        /** Delete copy constructor. */
+        AllocationScope(const AllocationScope &Copied) = delete;
+
+        /** Delete move constructor. */
+        AllocationScope(AllocationScope &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        AllocationScope &operator=(const AllocationScope &Copied) = delete;
+
+        /** Delete move constructor. */
+        AllocationScope &operator=(AllocationScope &&Moved) = delete;
+
+        // DESTRUCTOR
+
+        /** Counts allocations under the previous scope again. */
+        ~AllocationScope();
+
+        // CURRENT SCOPE
+
+        /** Returns the name of this thread's innermost scope, or nullptr if there is none. */
+        [[nodiscard]] static const char *Current();
+    };
+}
@@ -40,8 +40,10 @@ namespace FureyEngine {
     }
 
     // Returns a vector of a pointer to each frame in the animation sequence.
-    std::vector<Image *> Animation::Sequence() const {
-        std::vector<Image *> Sequence;
+    // The vector is allocated from the current thread's frame arena, so it must not outlive the current frame.
+    FrameVector<Image *> Animation::Sequence() const {
+        FrameVector<Image *> Sequence;
+        Sequence.reserve(Frames.Count());
         for (int i = 0; i < Frames.Count(); ++i) {
             Sequence.push_back(&Frames[i]);
         }
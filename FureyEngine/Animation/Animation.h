@@ -5,6 +5,7 @@
 #pragma once
 #include "../Image/Image.h"
 #include "../PointerArray/PointerArray.h"
+#include "../FrameArena/FrameArena.h"
 
 namespace FureyEngine {
     /** Creates and stores a static collection of images that can be played in a sequence to create an animation. */
@@ -66,8 +67,11 @@ namespace FureyEngine {
         /** Returns each frame's file extension. */
         [[nodiscard]] std::string Extension() const;
 
-        /** Returns a vector of a pointer to each frame in the animation sequence. */
-        [[nodiscard]] std::vector<Image *> Sequence() const;
+        /**
+         * Returns a vector of a pointer to each frame in the animation sequence.<br/>
+         * The vector is allocated from the current thread's frame arena, so it must not outlive the current frame.
+         */
+        [[nodiscard]] FrameVector<Image *> Sequence() const;
 
         /** Returns a pointer to the given frame in the animation sequence. */
         [[nodiscard]] Image *Frame(const int &Index) const;
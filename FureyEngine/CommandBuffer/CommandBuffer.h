@@ -0,0 +1,101 @@
+// .h
+// Command Buffer Class Script
+// by Kyle Furey
+
+#pragma once
+#include "../Reference/Reference.h"
+
+// The number of kinds of world commands.
+#define COMMAND_TYPE_COUNT 6
+
+namespace FureyEngine {
+    // Forward declaration of actor.
+    class Actor;
+
+    // Forward declaration of component.
+    class Component;
+
+    /**
+     * Each kind of structural change a world can defer until its next sync point.<br/>
+     * Commands are applied in the order of this enum, so spawns and attaches happen before removals and destructions.
+     */
+    enum class CommandType : unsigned char {
+        /** Moves a newly spawned actor into its world's actor list and queues its spawn events. */
+        SPAWN = 0,
+
+        /** Queues a newly attached component's attach events. */
+        ATTACH = 1,
+
+        /** Activates an actor or component. */
+        ACTIVATE = 2,
+
+        /** Deactivates an actor or component. */
+        DEACTIVATE = 3,
+
+        /** Calls a component's remove events and deletes it from its actor. */
+        REMOVE = 4,
+
+        /** Calls an actor's destroy events and deletes it from its world, or returns it to its pool. */
+        DESTROY = 5
+    };
+
+    /** A single recorded structural change to a world. */
+    struct Command final {
+        /** The actor this command applies to, or the owning actor of its component. */
+        Actor *TargetActor = nullptr;
+
+        /** The component this command applies to, or nullptr if it applies to an actor. */
+        Component *TargetComponent = nullptr;
+
+        /** The handle of the object this command applies to when it was recorded. */
+        ReferenceHandle Handle;
+    };
+
+    /**
+     * Records structural changes to a world during its update and applies them together at its next sync point.<br/>
+     * Each kind of command is stored in its own list, so recording is O(1) and the lists are already sorted by kind.<br/>
+     * The lists keep their capacity between updates, so recording does not allocate once they have grown.
+     */
+    class CommandBuffer final {
+        // COMMANDS
+
+        /** Each recorded command of each kind in the order they were recorded. */
+        std::vector<Command> Commands[COMMAND_TYPE_COUNT];
+
+        /** Worlds apply their recorded commands. */
+        friend class World;
+
+    public:
+        // COMMANDS
+
+        /** Records a command of the given kind that applies to the given object once this buffer is applied. */
+        void Record(const CommandType &Type, Actor *TargetActor, Component *TargetComponent,
+                    const ReferenceHandle &Handle) {
+            Commands[static_cast<int>(Type)].push_back({TargetActor, TargetComponent, Handle});
+        }
+
+        /** Returns the number of recorded commands waiting to be applied. */
+        [[nodiscard]] int Count() const {
+            int Total = 0;
+            for (const auto &List: Commands) {
+                Total += static_cast<int>(List.size());
+            }
+            return Total;
+        }
+
+        /** Returns the number of recorded commands of the given kind waiting to be applied. */
+        [[nodiscard]] int Count(const CommandType &Type) const {
+            return static_cast<int>(Commands[static_cast<int>(Type)].size());
+        }
+
+        /** Returns whether there are no recorded commands waiting to be applied. */
+        [[nodiscard]] bool IsEmpty() const {
+            for (const auto &List: Commands) {
+                if (!List.empty()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+}
@@ -0,0 +1,175 @@
+// .h
+// Component Table Class Script
+// by Kyle Furey
+
+#pragma once
+#include "../Components/Component.h"
+
+#define COMPONENT_TABLE_CHUNK_SIZE 256
+
+namespace FureyEngine {
+    // Forward declaration of actor.
+    class Actor;
+
+    /** Each way a world can store and iterate its components. */
+    enum class ComponentStorage {
+        /** Components are allocated individually and ticked through each actor's component list. */
+        ACTOR_LISTS = 0,
+
+        /** Components are allocated in contiguous tables by type and ticked linearly table by table. */
+        COMPONENT_TABLES = 1
+    };
+
+    /**
+     * A dense array of every component of a single type within a world.<br/>
+     * Components are stored alongside their owning actors so systems can iterate them linearly.
+     */
+    class ComponentTableBase : public std::enable_shared_from_this<ComponentTableBase> {
+    protected:
+        // TABLE
+
+        /** Each component in this table in dense order. */
+        std::vector<Component *> Components;
+
+        /** The owning actor of each component in this table in dense order. */
+        std::vector<Actor *> Actors;
+
+        /** Adds the given component and its owning actor to the end of this table. */
+        void Add(Component *AddedComponent, Actor *OwningActor) {
+            AddedComponent->Table = this;
+            AddedComponent->TableIndex = static_cast<int>(Components.size());
+            Components.push_back(AddedComponent);
+            Actors.push_back(OwningActor);
+        }
+
+        /** Returns whether the given component is currently stored in a table rather than pooled with its actor. */
+        [[nodiscard]] static bool IsStored(const Component *StoredComponent) {
+            return StoredComponent->TableIndex >= 0;
+        }
+
+        /** Removes the given component from this table by swapping it with the last component. */
+        void Remove(Component *RemovedComponent) {
+            const int Index = RemovedComponent->TableIndex;
+            if (RemovedComponent->Table != this || Index < 0 || static_cast<size_t>(Index) >= Components.size()) {
+                throw std::runtime_error("ERROR: Attempted to remove a component from a table it is not stored in!");
+            }
+            Components[Index] = Components.back();
+            Actors[Index] = Actors.back();
+            Components[Index]->TableIndex = Index;
+            Components.pop_back();
+            Actors.pop_back();
+            RemovedComponent->TableIndex = -1;
+        }
+
+        /** Worlds remove and add the components of pooled actors. */
+        friend class World;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new empty component table. */
+        ComponentTableBase() = default;
+
+        /** Delete copy constructor. */
+        ComponentTableBase(const ComponentTableBase &Copied) = delete;
+
+        /** Delete move constructor. */
+        ComponentTableBase(ComponentTableBase &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        ComponentTableBase &operator=(const ComponentTableBase &Copied) = delete;
+
+        /** Delete move constructor. */
+        ComponentTableBase &operator=(ComponentTableBase &&Moved) = delete;
+
+        // DESTRUCTOR
+
+        /** Properly destroys this component table. */
+        virtual ~ComponentTableBase() = default;
+
+        // TABLE
+
+        /** Returns the total number of components in this table. */
+        [[nodiscard]] int Count() const {
+            return static_cast<int>(Components.size());
+        }
+
+        /** Returns the component at the given dense index. */
+        [[nodiscard]] Component *GetComponent(const int &Index) const {
+            return Components[Index];
+        }
+
+        /** Returns the owning actor of the component at the given dense index. */
+        [[nodiscard]] Actor *GetActor(const int &Index) const {
+            return Actors[Index];
+        }
+    };
+
+    /**
+     * Stores every component of the given type within a world in contiguous chunks of memory.<br/>
+     * Components are stored whole rather than split into separate arrays of their fields, so a table only keeps<br/>
+     * components of one type next to each other for ForEachComponent(). Ticking uses each world's tick phase lists.<br/>
+     * Components allocated from a table are still owned by their actor through a shared pointer,<br/>
+     * whose separately allocated control block keeps this table alive until its component is destroyed.
+     */
+    template<typename ComponentType>
+    class ComponentTable final : public ComponentTableBase {
+        // STORAGE
+
+        /** Uninitialized storage for a single component. */
+        struct Slot final {
+            /** The raw memory of the component. */
+            alignas(ComponentType) unsigned char Memory[sizeof(ComponentType)];
+        };
+
+        /** Each chunk of component slots allocated by this table. */
+        std::vector<std::unique_ptr<Slot[]> > Chunks;
+
+        /** Each slot that is not currently storing a component. */
+        std::vector<Slot *> FreeSlots;
+
+        /** Allocates a new chunk of slots for this table. */
+        void Grow() {
+            auto &Chunk = Chunks.emplace_back(new Slot[COMPONENT_TABLE_CHUNK_SIZE]);
+            FreeSlots.reserve(FreeSlots.size() + COMPONENT_TABLE_CHUNK_SIZE);
+            for (int i = COMPONENT_TABLE_CHUNK_SIZE - 1; i >= 0; --i) {
+                FreeSlots.push_back(&Chunk[i]);
+            }
+        }
+
+    public:
+        // TABLE
+
+        /** Constructs a new component of this table's type for the given actor. */
+        template<typename... ArgumentTypes>
+        std::shared_ptr<ComponentType> New(Actor *OwningActor, ArgumentTypes &&... Arguments) {
+            if (FreeSlots.empty()) {
+                Grow();
+            }
+            Slot *Memory = FreeSlots.back();
+            FreeSlots.pop_back();
+
+            ComponentType *NewComponent;
+            try {
+                NewComponent = new(Memory) ComponentType(std::forward<ArgumentTypes>(Arguments)...);
+            } catch (...) {
+                FreeSlots.push_back(Memory);
+                throw;
+            }
+            Add(NewComponent, OwningActor);
+
+            // The deleter keeps this table alive until its last component is destroyed
+            return std::shared_ptr<ComponentType>(
+                NewComponent, [Table = std::static_pointer_cast<ComponentTable>(shared_from_this())](
+            ComponentType *DeletedComponent) {
+                    if (IsStored(DeletedComponent)) {
+                        Table->Remove(DeletedComponent);
+                    }
+                    DeletedComponent->~ComponentType();
+                    Table->FreeSlots.push_back(reinterpret_cast<Slot *>(DeletedComponent));
+                });
+        }
+    };
+}
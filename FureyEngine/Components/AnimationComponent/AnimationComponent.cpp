@@ -36,20 +36,24 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(AnimationComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&AnimationComponent::SetActive>(this);
 
         // Finds or attaches a render component if it does not exist
         if (!((RenderComponent = GetActor()->GetComponent<FureyEngine::RenderComponent>()))) {
             RenderComponent = GetActor()->AttachComponent<FureyEngine::RenderComponent>(nullptr);
         }
 
-        // Sets the animation delay
-        Delay = 1.0 / Animations.at(CurrentAnimation).Framerate;
+        // Sets the animation delay unless it was loaded from a snapshot
+        if (!Loaded) {
+            Delay = 1.0 / Animations.at(CurrentAnimation).Framerate;
+        }
 
         // Sets the render component's texture
         RenderComponent->SetImage(Animations.at(CurrentAnimation).Animation != nullptr
-                                      ? Animations.at(CurrentAnimation).Animation->Frame(0)
+                                      ? Animations.at(CurrentAnimation).Animation->Frame(
+                                          Loaded ? Animations.at(CurrentAnimation).CurrentFrame : 0)
                                       : nullptr);
+        Loaded = false;
     }
 
     // Automatically called each world tick.
@@ -147,8 +151,71 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(AnimationComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&AnimationComponent::SetActive>(this);
+        }
+    }
+
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    TickPhase AnimationComponent::GetTickPhases() const {
+        return TickLate ? TickPhase::LATE_TICK : TickPhase::TICK;
+    }
+
+    // Returns the state this component reads and writes while it ticks.
+    TickDependencies AnimationComponent::GetTickDependencies() const {
+        // Changing the render component's image updates the renderers
+        return {
+            TickAccess::OWNER | TickAccess::ENGINE,
+            TickAccess::OWNER | (RenderComponent ? TickAccess::ENGINE : TickAccess::NONE)
+        };
+    }
+
+    // SNAPSHOTS
+
+    // Writes each of this component's animation sequences and its playback state to the given snapshot.
+    // Each animation must be stored in the engine's animations to be saved.
+    void AnimationComponent::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Component::Save(Writer);
+
+        Writer.Write(CurrentAnimation);
+        Writer.Write(static_cast<unsigned int>(Animations.size()));
+        for (const auto &[AnimationName, Sequence]: Animations) {
+            Writer.Write(AnimationName);
+            Writer.Write(Resources::Animations.Find(Sequence.Animation));
+            Writer.Write(Sequence.Framerate);
+            Writer.Write(Sequence.CurrentFrame);
+        }
+        Writer.Write(Delay);
+        Writer.Write(Speed);
+        Writer.Write(Loop);
+        Writer.Write(Paused);
+        Writer.Write(FrameSkip);
+        Writer.Write(TickLate);
+    }
+
+    // Reads each of this component's animation sequences and its playback state from the given snapshot.
+    void AnimationComponent::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Component::Load(Reader);
+
+        Reader.Read(CurrentAnimation);
+        Animations.clear();
+        for (auto Count = Reader.Read<unsigned int>(); Count > 0; --Count) {
+            auto AnimationName = Reader.Read<std::string>();
+            auto *const AnimationResource = Resources::Animations.Find(Reader.Read<std::string>());
+            const auto Framerate = Reader.Read<int>();
+            const auto CurrentFrame = Reader.Read<int>();
+            Animations.try_emplace(AnimationName, AnimationName, AnimationResource, Framerate, CurrentFrame);
         }
+        Reader.Read(Delay);
+        Reader.Read(Speed);
+        Reader.Read(Loop);
+        Reader.Read(Paused);
+        Reader.Read(FrameSkip);
+        Reader.Read(TickLate);
+        Loaded = true;
     }
 
     // GETTERS
@@ -169,10 +236,11 @@ namespace FureyEngine {
     }
 
     // Returns a map of each animation name to a pointer to that animation sequence.
-    std::map<std::string, AnimationComponent::AnimationSequence *> AnimationComponent::GetAllAnimations() {
-        std::map<std::string, AnimationSequence *> Animations;
+    // The map is allocated from the current thread's frame arena, so it must not outlive the current frame.
+    FrameMap<std::string_view, AnimationComponent::AnimationSequence *> AnimationComponent::GetAllAnimations() {
+        FrameMap<std::string_view, AnimationSequence *> Animations;
         for (auto &[Key, Value]: this->Animations) {
-            Animations.at(Key) = &Value;
+            Animations.emplace_hint(Animations.end(), Key, &Value);
         }
         return Animations;
     }
@@ -48,6 +48,9 @@ namespace FureyEngine {
         /** The remaining time in seconds before advancing a frame in the animation. */
         double Delay = 0;
 
+        /** Whether this component was loaded from a snapshot, so attaching keeps its delay and current frame. */
+        bool Loaded = false;
+
     public:
         // ANIMATION
 
@@ -69,7 +72,10 @@ namespace FureyEngine {
         /** The number of frames to advance in each animation. */
         int FrameSkip = 1;
 
-        /** Whether to use LateTick() instead of Tick(). */
+        /**
+         * Whether to use LateTick() instead of Tick().<br/>
+         * Call RefreshTickPhases() after changing this once this component has started.
+         */
         bool TickLate = true;
 
         // CONSTRUCTORS
@@ -97,6 +103,25 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         void Remove() override;
 
+        // TICK PHASES
+
+        /** Returns each phase this component should tick in once it has started. */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        /** Returns the state this component reads and writes while it ticks. */
+        [[nodiscard]] TickDependencies GetTickDependencies() const override;
+
+        // SNAPSHOTS
+
+        /**
+         * Writes each of this component's animation sequences and its playback state to the given snapshot.<br/>
+         * Each animation must be stored in the engine's animations to be saved.
+         */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads each of this component's animation sequences and its playback state from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
+
         // GETTERS
 
         /** Returns a pointer to the current animation. */
@@ -108,8 +133,11 @@ namespace FureyEngine {
         /** Returns a pointer to the given animation or nullptr if it does not exist. */
         [[nodiscard]] virtual AnimationSequence *operator[](const std::string &AnimationName);
 
-        /** Returns a map of each animation name to a pointer to that animation sequence. */
-        [[nodiscard]] virtual std::map<std::string, AnimationSequence *> GetAllAnimations();
+        /**
+         * Returns a map of each animation name to a pointer to that animation sequence.<br/>
+         * The map is allocated from the current thread's frame arena, so it must not outlive the current frame.
+         */
+        [[nodiscard]] virtual FrameMap<std::string_view, AnimationSequence *> GetAllAnimations();
 
         /** Returns whether the given animation exists in this component by name. */
         [[nodiscard]] virtual bool HasAnimation(const std::string &AnimationName) const;
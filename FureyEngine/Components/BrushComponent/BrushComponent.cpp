@@ -45,11 +45,8 @@ namespace FureyEngine {
 
     // Destroys this brush component.
     BrushComponent::~BrushComponent() {
-        // Removes this brush from the set of all brushes
-        AllBrushes[static_cast<World *>(GetActor()->GetWorld())].erase(this);
-        if (AllBrushes[static_cast<World *>(GetActor()->GetWorld())].empty()) {
-            AllBrushes.erase(static_cast<World *>(GetActor()->GetWorld()));
-        }
+        // Removes this brush from the set of all brushes and each other brush's collision states
+        RemoveBrush(true);
     }
 
     // Automatically called before each component has already called Start().
@@ -58,10 +55,10 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(BrushComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&BrushComponent::SetActive>(this);
 
         // Adds this brush to the set of all brushes
-        AllBrushes[static_cast<World *>(GetActor()->GetWorld())].insert(this);
+        AddBrush();
 
         // Finds a render component if one was not valid
         if (Bounds.Scale.x == FLT_MAX && Bounds.Scale.y == FLT_MAX) {
@@ -77,8 +74,22 @@ namespace FureyEngine {
         // Calls the base class's function
         Component::Start();
 
+        // Restore the collision states loaded from a snapshot instead of colliding again
+        if (!LoadedCollisionStates.empty()) {
+            for (const auto &Element: WorldBrushes()) {
+                for (const auto &[Order, State]: LoadedCollisionStates) {
+                    if (Element != this && Element->GetAttachOrder() == Order) {
+                        CollisionStates[Element] = State;
+                        break;
+                    }
+                }
+            }
+            LoadedCollisionStates.clear();
+            return;
+        }
+
         // Update collision responses
-        for (const auto &Element: AllBrushes[static_cast<World *>(GetActor()->GetWorld())]) {
+        for (const auto &Element: WorldBrushes()) {
             if (Element == this) {
                 continue;
             }
@@ -99,10 +110,13 @@ namespace FureyEngine {
 
         // Update collision responses
         if (!TickLate) {
-            for (const auto &Element: AllBrushes[static_cast<World *>(GetActor()->GetWorld())]) {
+            PROFILE_ZONE("BrushComponent::Collision");
+            unsigned long long Tested = 0;
+            for (const auto &Element: WorldBrushes()) {
                 if (Element == this) {
                     continue;
                 }
+                ++Tested;
 
                 if (const auto OtherBrush = Reference(Element);
                     OtherBrush->IsActive() && !OtherBrush->Trigger && (Layer == "All" || Layer == OtherBrush->Layer) &&
@@ -127,6 +141,7 @@ namespace FureyEngine {
                     }
                 }
             }
+            TestedPairs.fetch_add(Tested, std::memory_order_relaxed);
         }
     }
 
@@ -137,10 +152,13 @@ namespace FureyEngine {
 
         // Update collision responses
         if (TickLate) {
-            for (const auto &Element: AllBrushes[static_cast<World *>(GetActor()->GetWorld())]) {
+            PROFILE_ZONE("BrushComponent::Collision");
+            unsigned long long Tested = 0;
+            for (const auto &Element: WorldBrushes()) {
                 if (Element == this) {
                     continue;
                 }
+                ++Tested;
 
                 if (const auto OtherBrush = Reference(Element);
                     OtherBrush->IsActive() && !OtherBrush->Trigger && (Layer == "All" || Layer == OtherBrush->Layer) &&
@@ -165,6 +183,7 @@ namespace FureyEngine {
                     }
                 }
             }
+            TestedPairs.fetch_add(Tested, std::memory_order_relaxed);
         }
     }
 
@@ -175,8 +194,20 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(BrushComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&BrushComponent::SetActive>(this);
         }
+
+        // Removes this brush from the set of all brushes so pooled brushes are never collided with
+        RemoveBrush(true);
+        CollisionStates.clear();
+    }
+
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    // This component ticks in fixed simulation steps when its world uses a fixed time step.
+    TickPhase BrushComponent::GetTickPhases() const {
+        return SimulationTickPhase(TickLate ? TickPhase::LATE_TICK : TickPhase::TICK);
     }
 
     // ACTIVITY
@@ -187,11 +218,11 @@ namespace FureyEngine {
         // Add or remove this brush from the world's brushes
         if (IsActive()) {
             if (!Active) {
-                AllBrushes[static_cast<World *>(GetActor()->GetWorld())].erase(this);
+                RemoveBrush(false);
             }
         } else {
             if (Active) {
-                AllBrushes[static_cast<World *>(GetActor()->GetWorld())].insert(this);
+                AddBrush();
             }
         }
 
@@ -208,6 +239,42 @@ namespace FureyEngine {
         }
     }
 
+    // SNAPSHOTS
+
+    // Writes this brush's bounds, settings and collision states to the given snapshot.
+    void BrushComponent::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Component::Save(Writer);
+
+        Writer.Write(Bounds);
+        Writer.Write(Trigger);
+        Writer.Write(Layer);
+        Writer.Write(TickLate);
+        Writer.Write(static_cast<unsigned int>(CollisionStates.size()));
+        for (const auto &[Brush, State]: CollisionStates) {
+            Writer.Write(Brush->GetAttachOrder());
+            Writer.Write(State);
+        }
+    }
+
+    // Reads this brush's bounds, settings and collision states from the given snapshot.
+    // Collision states are restored when this brush starts, so collisions are not entered again.
+    void BrushComponent::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Component::Load(Reader);
+
+        Reader.Read(Bounds);
+        Reader.Read(Trigger);
+        Reader.Read(Layer);
+        Reader.Read(TickLate);
+        CollisionStates.clear();
+        LoadedCollisionStates.resize(Reader.Read<unsigned int>());
+        for (auto &[Order, State]: LoadedCollisionStates) {
+            Reader.Read(Order);
+            Reader.Read(State);
+        }
+    }
+
     // GETTERS
 
     // Calculates the world position at the center of the brush relative to its actor's bounds.
@@ -365,7 +432,7 @@ namespace FureyEngine {
             return nullref;
         }
 
-        for (const auto &Element: AllBrushes[static_cast<World *>(GetActor()->GetWorld())]) {
+        for (const auto &Element: WorldBrushes()) {
             if (Element == this || Element->Trigger) {
                 continue;
             }
@@ -376,8 +443,58 @@ namespace FureyEngine {
         return nullref;
     }
 
+    // Returns the total number of brush pairs tested for collision in every world since the engine started.
+    unsigned long long BrushComponent::PairsTested() {
+        return TestedPairs.load(std::memory_order_relaxed);
+    }
+
+    // BRUSHES
+
+    // Returns each brush in this brush's world in the order they were attached, without adding its world.
+    const std::set<BrushComponent *, AttachOrderLess> &BrushComponent::WorldBrushes() const {
+        static const std::set<BrushComponent *, AttachOrderLess> NoBrushes;
+        std::lock_guard Lock(BrushesMutex);
+        const auto Brushes = AllBrushes.find(static_cast<World *>(GetActor()->GetWorld()));
+        return Brushes != AllBrushes.end() ? Brushes->second : NoBrushes;
+    }
+
+    // Adds this brush to its world's brushes.
+    void BrushComponent::AddBrush() {
+        std::lock_guard Lock(BrushesMutex);
+        AllBrushes[static_cast<World *>(GetActor()->GetWorld())].insert(this);
+    }
+
+    // Removes this brush from its world's brushes.
+    // Other brushes also forget their collisions with this brush if the given boolean is true.
+    void BrushComponent::RemoveBrush(const bool &ForgetCollisions) {
+        std::lock_guard Lock(BrushesMutex);
+        const auto Brushes = AllBrushes.find(static_cast<World *>(GetActor()->GetWorld()));
+        if (Brushes == AllBrushes.end()) {
+            return;
+        }
+        Brushes->second.erase(this);
+
+        // Removes this brush from each other brush's collision states so they never order a removed brush
+        if (ForgetCollisions) {
+            for (const auto &Brush: Brushes->second) {
+                Brush->CollisionStates.erase(this);
+            }
+        }
+        if (Brushes->second.empty()) {
+            AllBrushes.erase(Brushes);
+        }
+    }
+
     // STATIC VARIABLE INITIALIZATION
 
-    // Each instantiated brush component in each world.
-    std::map<World *, std::set<BrushComponent *> > BrushComponent::AllBrushes;
+    // Each instantiated brush component in each world in the order they were attached.
+    // Brushes are never ordered by address so collisions are responded to in the same order each run.
+    std::map<World *, std::set<BrushComponent *, AttachOrderLess> > BrushComponent::AllBrushes;
+
+    // Guards the map of each world's brushes, which isolated worlds add to and remove from on separate threads.
+    // Each world's set of brushes is only read and written by the thread updating that world.
+    std::mutex BrushComponent::BrushesMutex;
+
+    // The total number of brush pairs tested for collision in every world since the engine started.
+    std::atomic<unsigned long long> BrushComponent::TestedPairs = 0;
 }
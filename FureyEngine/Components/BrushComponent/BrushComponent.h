@@ -55,11 +55,41 @@ namespace FureyEngine {
     protected:
         // BRUSH
 
-        /** Each instantiated brush component in each world. */
-        static std::map<World *, std::set<BrushComponent *> > AllBrushes;
+        /**
+         * Each instantiated brush component in each world in the order they were attached.<br/>
+         * Brushes are never ordered by address so collisions are responded to in the same order each run.
+         */
+        static std::map<World *, std::set<BrushComponent *, AttachOrderLess> > AllBrushes;
 
-        /** The current state of this brush's collision with other brushes. */
-        std::map<BrushComponent *, CollisionState> CollisionStates;
+        /**
+         * Guards the map of each world's brushes, which isolated worlds add to and remove from on separate threads.<br/>
+         * Each world's set of brushes is only read and written by the thread updating that world.
+         */
+        static std::mutex BrushesMutex;
+
+        /** The current state of this brush's collision with other brushes in the order they were attached. */
+        std::map<BrushComponent *, CollisionState, AttachOrderLess> CollisionStates;
+
+        /**
+         * The attach order of each brush this brush was colliding with and the state of that collision<br/>
+         * when it was loaded from a snapshot, which are found once each brush has been attached.
+         */
+        std::vector<std::pair<unsigned long long, CollisionState> > LoadedCollisionStates;
+
+        /** The total number of brush pairs tested for collision in every world since the engine started. */
+        static std::atomic<unsigned long long> TestedPairs;
+
+        /** Returns each brush in this brush's world in the order they were attached, without adding its world. */
+        [[nodiscard]] const std::set<BrushComponent *, AttachOrderLess> &WorldBrushes() const;
+
+        /** Adds this brush to its world's brushes. */
+        void AddBrush();
+
+        /**
+         * Removes this brush from its world's brushes.<br/>
+         * Other brushes also forget their collisions with this brush if the given boolean is true.
+         */
+        void RemoveBrush(const bool &ForgetCollisions);
 
     public:
         // BRUSH
@@ -83,7 +113,10 @@ namespace FureyEngine {
          */
         std::string Layer = "All";
 
-        /** Whether to use LateTick() instead of Tick(). */
+        /**
+         * Whether to use LateTick() instead of Tick().<br/>
+         * Call RefreshTickPhases() after changing this once this component has started.
+         */
         bool TickLate = true;
 
 
@@ -129,6 +162,14 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         void Remove() override;
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this component should tick in once it has started.<br/>
+         * This component ticks in fixed simulation steps when its world uses a fixed time step.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
         // ACTIVITY
 
         /**
@@ -137,6 +178,17 @@ namespace FureyEngine {
          */
         void SetActive(const bool &Active) override;
 
+        // SNAPSHOTS
+
+        /** Writes this brush's bounds, settings and collision states to the given snapshot. */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /**
+         * Reads this brush's bounds, settings and collision states from the given snapshot.<br/>
+         * Collision states are restored when this brush starts, so collisions are not entered again.
+         */
+        void Load(SnapshotReader &Reader) override;
+
         // GETTERS
 
         /** Calculates the world position at the center of the brush relative to its actor's bounds. */
@@ -172,5 +224,8 @@ namespace FureyEngine {
 
         /** Returns the first brush found that this brush is currently being overlapped by (not including triggers). */
         [[nodiscard]] virtual Reference<BrushComponent> IsColliding() const;
+
+        /** Returns the total number of brush pairs tested for collision in every world since the engine started. */
+        [[nodiscard]] static unsigned long long PairsTested();
     };
 }
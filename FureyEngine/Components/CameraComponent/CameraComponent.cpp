@@ -32,7 +32,7 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(CameraComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&CameraComponent::SetActive>(this);
 
         // Set the camera's position
         SnapPosition();
@@ -45,11 +45,12 @@ namespace FureyEngine {
 
         // Update the camera's position
         if (!TickLate) {
+            const glm::vec2 Target = GetActor()->GetInterpolatedTransform().Position;
             for (const auto &Renderer: TargetRenderers) {
                 auto &Camera = Resources::Renderers[Renderer];
-                Camera.Position.x = Math::Lerp(Camera.Position.x, GetActor()->Transform.Position.x + Offset.x,
+                Camera.Position.x = Math::Lerp(Camera.Position.x, Target.x + Offset.x,
                                                static_cast<float>(FollowSpeed.x >= 0 ? FollowSpeed.x * DeltaTime : 1));
-                Camera.Position.y = Math::Lerp(Camera.Position.y, GetActor()->Transform.Position.y + Offset.y,
+                Camera.Position.y = Math::Lerp(Camera.Position.y, Target.y + Offset.y,
                                                static_cast<float>(FollowSpeed.y >= 0 ? FollowSpeed.y * DeltaTime : 1));
                 Camera.Position.x = ClampMin.x > ClampMax.x
                                         ? Camera.Position.x
@@ -69,11 +70,12 @@ namespace FureyEngine {
 
         // Update the camera's position
         if (TickLate) {
+            const glm::vec2 Target = GetActor()->GetInterpolatedTransform().Position;
             for (const auto &Renderer: TargetRenderers) {
                 auto &Camera = Resources::Renderers[Renderer];
-                Camera.Position.x = Math::Lerp(Camera.Position.x, GetActor()->Transform.Position.x + Offset.x,
+                Camera.Position.x = Math::Lerp(Camera.Position.x, Target.x + Offset.x,
                                                static_cast<float>(FollowSpeed.x >= 0 ? FollowSpeed.x * DeltaTime : 1));
-                Camera.Position.y = Math::Lerp(Camera.Position.y, GetActor()->Transform.Position.y + Offset.y,
+                Camera.Position.y = Math::Lerp(Camera.Position.y, Target.y + Offset.y,
                                                static_cast<float>(FollowSpeed.y >= 0 ? FollowSpeed.y * DeltaTime : 1));
                 Camera.Position.x = ClampMin.x > ClampMax.x
                                         ? Camera.Position.x
@@ -93,18 +95,68 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(CameraComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&CameraComponent::SetActive>(this);
         }
     }
 
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    // Headless builds have no renderers to move, so cameras do not tick.
+    TickPhase CameraComponent::GetTickPhases() const {
+#if HEADLESS
+        return TickPhase::NONE;
+#else
+        return TickLate ? TickPhase::LATE_TICK : TickPhase::TICK;
+#endif
+    }
+
+
+    // SNAPSHOTS
+
+    // Writes this camera's settings and target renderers to the given snapshot.
+    void CameraComponent::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Component::Save(Writer);
+
+        Writer.Write(Offset);
+        Writer.Write(FollowSpeed);
+        Writer.Write(ClampMin);
+        Writer.Write(ClampMax);
+        Writer.Write(static_cast<unsigned int>(TargetRenderers.size()));
+        for (const auto &Renderer: TargetRenderers) {
+            Writer.Write(Renderer);
+        }
+        Writer.Write(TickLate);
+        Writer.Write(NearbyDistance);
+    }
+
+    // Reads this camera's settings and target renderers from the given snapshot.
+    void CameraComponent::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Component::Load(Reader);
+
+        Reader.Read(Offset);
+        Reader.Read(FollowSpeed);
+        Reader.Read(ClampMin);
+        Reader.Read(ClampMax);
+        TargetRenderers.clear();
+        for (auto Count = Reader.Read<unsigned int>(); Count > 0; --Count) {
+            TargetRenderers.insert(Reader.Read<std::string>());
+        }
+        Reader.Read(TickLate);
+        Reader.Read(NearbyDistance);
+    }
 
     // CAMERA
 
     // Immediately updates the renderers' positions to this component's actor's position.
     void CameraComponent::SnapPosition() const {
+#if !HEADLESS
+        const glm::vec2 Target = GetActor()->GetInterpolatedTransform().Position;
         for (const auto &Renderer: TargetRenderers) {
             auto &Camera = Resources::Renderers[Renderer];
-            Camera.Position = GetActor()->Transform.Position;
+            Camera.Position = Target;
             Camera.Position.x += Offset.x;
             Camera.Position.y += Offset.y;
             Camera.Position.x = ClampMin.x > ClampMax.x
@@ -115,6 +167,7 @@ namespace FureyEngine {
                                     ? Camera.Position.y
                                     : SDL_clamp(Camera.Position.y, ClampMin.y, ClampMax.y);
         }
+#endif
     }
 
     // Calculates the world position at the center of the screen (originating from the actor).
@@ -210,4 +263,34 @@ namespace FureyEngine {
         return WorldPosition.x >= Min.x && WorldPosition.x <= Max.x &&
                WorldPosition.y >= Min.y && WorldPosition.y <= Max.y;
     }
+
+    // RELEVANCE
+
+    // Returns how relevant the given actor is to this camera.
+    // Actors in view are visible, actors within the nearby distance of the view are nearby, and others are distant.
+    TickRelevance CameraComponent::GetRelevance(const Actor *RelevantActor) const {
+        const auto &Position = RelevantActor->Transform.Position;
+        const auto Min = BottomLeft();
+        const auto Max = TopRight();
+        if (Position.x >= Min.x && Position.x <= Max.x &&
+            Position.y >= Min.y && Position.y <= Max.y) {
+            return TickRelevance::VISIBLE;
+        }
+        if (Position.x >= Min.x - NearbyDistance && Position.x <= Max.x + NearbyDistance &&
+            Position.y >= Min.y - NearbyDistance && Position.y <= Max.y + NearbyDistance) {
+            return TickRelevance::NEARBY;
+        }
+        return TickRelevance::DISTANT;
+    }
+
+    // Returns a relevance policy that throttles ticking actors and components by their relevance to this camera.
+    // Assign this to a world's RelevancePolicy. Every actor is visible once this camera is destroyed.
+    std::function<TickRelevance(const Actor *)> CameraComponent::RelevancePolicy() {
+        return [Camera = Reference<CameraComponent>(this)](const Actor *RelevantActor) {
+            const auto Instance = Camera.Get();
+            return Instance != nullptr && Instance->GetActor()
+                       ? Instance->GetRelevance(RelevantActor)
+                       : TickRelevance::VISIBLE;
+        };
+    }
 }
@@ -35,9 +35,17 @@ namespace FureyEngine {
         /** This camera's target renderers. */
         std::set<std::string> TargetRenderers = {"main"};
 
-        /** Whether to use LateTick() instead of Tick(). */
+        /**
+         * Whether to use LateTick() instead of Tick().<br/>
+         * Call RefreshTickPhases() after changing this once this component has started.
+         */
         bool TickLate = true;
 
+        /**
+         * How far outside of this camera's view (in world space) actors are still nearby rather than distant.<br/>
+         * This is only used by RelevancePolicy().
+         */
+        float NearbyDistance = static_cast<float>(SCREEN_WIDTH);
 
         // CONSTRUCTORS
 
@@ -64,6 +72,22 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         void Remove() override;
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this component should tick in once it has started.<br/>
+         * Headless builds have no renderers to move, so cameras do not tick.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // SNAPSHOTS
+
+        /** Writes this camera's settings and target renderers to the given snapshot. */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads this camera's settings and target renderers from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
+
         // CAMERA
 
         /** Immediately updates the renderers' positions to this component's actor's position. */
@@ -98,5 +122,19 @@ namespace FureyEngine {
 
         /** Returns whether the given point is in the view of the camera (originating from the actor). */
         [[nodiscard]] virtual bool IsInView(const glm::vec2 &WorldPosition) const;
+
+        // RELEVANCE
+
+        /**
+         * Returns how relevant the given actor is to this camera.<br/>
+         * Actors in view are visible, actors within the nearby distance of the view are nearby, and others are distant.
+         */
+        [[nodiscard]] virtual TickRelevance GetRelevance(const Actor *RelevantActor) const;
+
+        /**
+         * Returns a relevance policy that throttles ticking actors and components by their relevance to this camera.<br/>
+         * Assign this to a world's RelevancePolicy. Every actor is visible once this camera is destroyed.
+         */
+        [[nodiscard]] std::function<TickRelevance(const Actor *)> RelevancePolicy();
     };
 }
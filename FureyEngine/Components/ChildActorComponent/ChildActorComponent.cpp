@@ -30,7 +30,7 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(ChildActorComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&ChildActorComponent::SetActive>(this);
 
         // Parent the component's actor to its parent actor
         if (RelativeTransform.Position.x == FLT_MAX && RelativeTransform.Position.y == FLT_MAX) {
@@ -79,10 +79,23 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(ChildActorComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&ChildActorComponent::SetActive>(this);
         }
     }
 
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    TickPhase ChildActorComponent::GetTickPhases() const {
+        return TickLate ? TickPhase::LATE_TICK : TickPhase::TICK;
+    }
+
+    // Returns the state this component reads and writes while it ticks.
+    TickDependencies ChildActorComponent::GetTickDependencies() const {
+        // The parent actor is read but never written
+        return {TickAccess::OWNER | TickAccess::WORLD, TickAccess::OWNER};
+    }
+
     // GETTERS
 
     // Returns this component's actor's parent actor.
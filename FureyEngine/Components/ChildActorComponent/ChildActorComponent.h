@@ -23,7 +23,10 @@ namespace FureyEngine {
         /** Transform values to use when applying this actor's transform to its parent's. */
         Transform RelativeTransform = Transform();
 
-        /** Whether to use LateTick() instead of Tick(). */
+        /**
+         * Whether to use LateTick() instead of Tick().<br/>
+         * Call RefreshTickPhases() after changing this once this component has started.
+         */
         bool TickLate = true;
 
 
@@ -52,6 +55,14 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         void Remove() override;
 
+        // TICK PHASES
+
+        /** Returns each phase this component should tick in once it has started. */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        /** Returns the state this component reads and writes while it ticks. */
+        [[nodiscard]] TickDependencies GetTickDependencies() const override;
+
         // GETTERS
 
         /** Returns this component's actor's parent actor. */
@@ -3,6 +3,7 @@
 // by Kyle Furey
 
 #include "Component.h"
+#include "../Worlds/World.h"
 
 namespace FureyEngine {
     // CONSTRUCTORS
@@ -44,6 +45,19 @@ namespace FureyEngine {
         return AttachTimePoint;
     }
 
+    // Returns the order this component was attached in relative to every other actor and component in its world.
+    // Sort by this instead of by address so iteration order is the same each time a world is simulated.
+    unsigned long long Component::GetAttachOrder() const {
+        return AttachOrder;
+    }
+
+    // REFERENCE
+
+    // Returns this component's handle in the reference registry.
+    const ReferenceHandle &Component::GetHandle() const {
+        return MySlot.Handle();
+    }
+
     // EVENTS
 
     // Automatically called before each component has already called Start().
@@ -71,6 +85,70 @@ namespace FureyEngine {
         // std::cout << "Component \"" << Name << "\" was removed." << std::endl;
     }
 
+    // Automatically called after this component's pooled actor is destroyed and returned to its pool.
+    // Override this to restore any state that should not carry over when the actor is spawned again.
+    void Component::Reset() {
+    }
+
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    // Override this to only return the phases this component overrides so its world can skip it otherwise.
+    // Phases with bound OnTick or OnLateTick events are always included.
+    TickPhase Component::GetTickPhases() const {
+        return TickPhase::ALL;
+    }
+
+    // Returns the given variable tick phases, or their fixed simulation step equivalent
+    // if this component's world uses a fixed time step.
+    // Simulation components such as physics and collision return this from GetTickPhases().
+    TickPhase Component::SimulationTickPhase(const TickPhase &Phases) const {
+        if (MyActor && MyActor->GetWorld() && MyActor->GetWorld()->GetFixedTimeStep() > 0) {
+            return ToFixedTickPhase(Phases);
+        }
+        return Phases;
+    }
+
+    // Registers this component with its world again using its current tick phases.
+    // Call this after changing anything that GetTickPhases() or its bound tick events depend on.
+    void Component::RefreshTickPhases() {
+        if (BeginTick && MyActor && MyActor->GetWorld()) {
+            MyActor->GetWorld()->RegisterTickPhases(this);
+        }
+    }
+
+    // Returns how often this component ticks in the variable tick phases once it has started.
+    // Override this to tick less often, or to tick less often while its world considers it nearby or distant.
+    // Call RefreshTickPhases() after changing anything this depends on.
+    TickRate Component::GetTickRate() const {
+        return {};
+    }
+
+    // Returns the state this component reads and writes while it ticks.
+    // Components that only write to their owning actor can tick on worker threads alongside other actors.
+    // By default every kind of state is accessed, so this component always ticks serially.
+    TickDependencies Component::GetTickDependencies() const {
+        return {};
+    }
+
+    // SNAPSHOTS
+
+    // Writes this component's state to the given snapshot.
+    // Override this to save custom state, calling the base method first.
+    void Component::Save(SnapshotWriter &Writer) const {
+        Writer.Write(Name);
+        Writer.Write(Tag);
+        Writer.Write(Active);
+    }
+
+    // Reads this component's state from the given snapshot in the same order it was saved.
+    // Override this to load custom state, calling the base method first.
+    void Component::Load(SnapshotReader &Reader) {
+        Reader.Read(Name);
+        Reader.Read(Tag);
+        Reader.Read(Active);
+    }
+
     // ACTIVITY
 
     // Returns whether this component is active.
@@ -88,5 +166,5 @@ namespace FureyEngine {
     // STATIC VARIABLE INITIALIZATION
 
     // The total number of components currently allocated.
-    int Component::TotalComponents;
+    std::atomic<int> Component::TotalComponents = 0;
 }
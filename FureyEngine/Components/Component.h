@@ -6,33 +6,84 @@
 #include "../Delegate/Delegate.h"
 #include "../Event/Event.h"
 #include "../Reference/Reference.h"
+#include "../Snapshot/Snapshot.h"
+#include "../TickPhase/TickPhase.h"
+#include "../TickAccess/TickAccess.h"
+#include "../TickRate/TickRate.h"
 
 namespace FureyEngine {
     // Forward declaration of actor.
     class Actor;
 
+    // Forward declaration of world.
+    class World;
+
+    // Forward declaration of component table.
+    class ComponentTableBase;
+
     /**
      * Represents modular code that can be attached to an actor.<br/>
      * Inherit from this class to override scriptable methods and add custom logic.<br/>
      * NOTE: Components should be constructed within their actors using Actor->AttachComponent(...).
      */
     class Component : public std::enable_shared_from_this<Component> {
+        // REFERENCE
+
+        /** This component's handle in the reference registry, which is released after every other member. */
+        ReferenceSlot MySlot;
+
         // ACTOR
 
         /** This component's owning actor. */
         Reference<Actor> MyActor;
 
         /** The time point this component was attached to an actor. */
-        const std::chrono::high_resolution_clock::time_point AttachTimePoint =
-                std::chrono::high_resolution_clock::now();
+        std::chrono::high_resolution_clock::time_point AttachTimePoint = std::chrono::high_resolution_clock::now();
+
+        /** The order this component was attached in relative to every other actor and component in its world. */
+        unsigned long long AttachOrder = 0;
 
         /** Whether this component is active and should tick. */
         bool Active = true;
 
+        /** Whether this component was active before its actor was returned to its pool. */
+        bool ActiveBeforePool = true;
+
+        /** Whether this component's attach events have been called since it was last removed. */
+        bool Attached = false;
+
+        // STORAGE
+
+        /** The component table this component is stored in, or nullptr if it is not stored in a table. */
+        ComponentTableBase *Table = nullptr;
+
+        /** This component's index within its component table, or -1 while its actor is pooled. */
+        int TableIndex = -1;
+
+        /** Component tables manage each component's table index. */
+        friend class ComponentTableBase;
+
+        // TICK PHASES
+
+        /** This component's index within each of its world's tick phase lists, or -1 if it is not registered. */
+        int TickIndices[TICK_PHASE_COUNT] = {-1, -1, -1, -1};
+
+        /** This component's tick rate and its progress toward its next tick in each variable tick phase. */
+        TickThrottle Throttle;
+
+        /** Worlds manage each component's tick phase indices. */
+        friend class World;
+
+        /** This component's position in its owning actor's component list. */
+        std::list<std::shared_ptr<Component> >::iterator ActorIterator;
+
+        /** Actors manage each component's position in their component list. */
+        friend class Actor;
+
         // TOTAL COMPONENTS
 
         /** The total number of components currently allocated. */
-        static int TotalComponents;
+        static std::atomic<int> TotalComponents;
 
     public:
         // COMPONENT SETTINGS
@@ -122,6 +173,17 @@ namespace FureyEngine {
         /** Returns this component's attach time. */
         [[nodiscard]] std::chrono::high_resolution_clock::time_point AttachTime() const;
 
+        /**
+         * Returns the order this component was attached in relative to every other actor and component in its world.<br/>
+         * Sort by this instead of by address so iteration order is the same each time a world is simulated.
+         */
+        [[nodiscard]] unsigned long long GetAttachOrder() const;
+
+        // REFERENCE
+
+        /** Returns this component's handle in the reference registry. */
+        [[nodiscard]] const ReferenceHandle &GetHandle() const;
+
         // EVENTS
 
         /** Automatically called before each component has already called Start(). */
@@ -139,6 +201,62 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         virtual void Remove();
 
+        /**
+         * Automatically called after this component's pooled actor is destroyed and returned to its pool.<br/>
+         * Override this to restore any state that should not carry over when the actor is spawned again.
+         */
+        virtual void Reset();
+
+        // TICK PHASES
+
+        /**
+         * Returns each phase this component should tick in once it has started.<br/>
+         * Override this to only return the phases this component overrides so its world can skip it otherwise.<br/>
+         * Phases with bound OnTick or OnLateTick events are always included.
+         */
+        [[nodiscard]] virtual TickPhase GetTickPhases() const;
+
+        /**
+         * Returns the given variable tick phases, or their fixed simulation step equivalent<br/>
+         * if this component's world uses a fixed time step.<br/>
+         * Simulation components such as physics and collision return this from GetTickPhases().
+         */
+        [[nodiscard]] TickPhase SimulationTickPhase(const TickPhase &Phases) const;
+
+        /**
+         * Registers this component with its world again using its current tick phases.<br/>
+         * Call this after changing anything that GetTickPhases() or its bound tick events depend on.
+         */
+        void RefreshTickPhases();
+
+        /**
+         * Returns how often this component ticks in the variable tick phases once it has started.<br/>
+         * Override this to tick less often, or to tick less often while its world considers it nearby or distant.<br/>
+         * Call RefreshTickPhases() after changing anything this depends on.
+         */
+        [[nodiscard]] virtual TickRate GetTickRate() const;
+
+        /**
+         * Returns the state this component reads and writes while it ticks.<br/>
+         * Components that only write to their owning actor can tick on worker threads alongside other actors.<br/>
+         * By default every kind of state is accessed, so this component always ticks serially.
+         */
+        [[nodiscard]] virtual TickDependencies GetTickDependencies() const;
+
+        // SNAPSHOTS
+
+        /**
+         * Writes this component's state to the given snapshot.<br/>
+         * Override this to save custom state, calling the base method first.
+         */
+        virtual void Save(SnapshotWriter &Writer) const;
+
+        /**
+         * Reads this component's state from the given snapshot in the same order it was saved.<br/>
+         * Override this to load custom state, calling the base method first.
+         */
+        virtual void Load(SnapshotReader &Reader);
+
         // CASTING
 
         /** Returns whether this component is the given component type. */
@@ -167,4 +285,12 @@ namespace FureyEngine {
          */
         virtual void SetActive(const bool &Active);
     };
+
+    /** Orders components by the order they were attached to their world instead of by their addresses. */
+    struct AttachOrderLess final {
+        /** Returns whether the left component was attached before the right component. */
+        [[nodiscard]] bool operator()(const Component *Left, const Component *Right) const {
+            return Left->GetAttachOrder() < Right->GetAttachOrder();
+        }
+    };
 }
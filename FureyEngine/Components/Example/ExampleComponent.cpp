@@ -22,7 +22,7 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(ExampleComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&ExampleComponent::SetActive>(this);
 
         // New code here
     }
@@ -58,7 +58,7 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(ExampleComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&ExampleComponent::SetActive>(this);
         }
 
         // New code here
@@ -27,7 +27,7 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(MovementComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&MovementComponent::SetActive>(this);
 
         if (!BrushComponent) {
             BrushComponent = GetActor()->GetComponent<FureyEngine::BrushComponent>();
@@ -291,7 +291,58 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(MovementComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&MovementComponent::SetActive>(this);
         }
     }
+
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    // This component ticks in fixed simulation steps when its world uses a fixed time step.
+    TickPhase MovementComponent::GetTickPhases() const {
+        return SimulationTickPhase(TickLate ? TickPhase::LATE_TICK : TickPhase::TICK);
+    }
+
+    // Returns the state this component reads and writes while it ticks.
+    TickDependencies MovementComponent::GetTickDependencies() const {
+        // Collision checks read other actors' brushes
+        return {
+            TickAccess::OWNER | TickAccess::ENGINE | (BrushComponent ? TickAccess::WORLD : TickAccess::NONE),
+            TickAccess::OWNER
+        };
+    }
+
+    // SNAPSHOTS
+
+    // Writes this component's velocity and movement settings to the given snapshot.
+    void MovementComponent::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Component::Save(Writer);
+
+        Writer.Write(Speed);
+        Writer.Write(Acceleration);
+        Writer.Write(Deceleration);
+        Writer.Write(Velocity);
+        Writer.Write(UseKeyboard);
+        Writer.Write(ControllerIndex);
+        Writer.Write(RelativeToRotation);
+        Writer.Write(SpeedModifier);
+        Writer.Write(TickLate);
+    }
+
+    // Reads this component's velocity and movement settings from the given snapshot.
+    void MovementComponent::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Component::Load(Reader);
+
+        Reader.Read(Speed);
+        Reader.Read(Acceleration);
+        Reader.Read(Deceleration);
+        Reader.Read(Velocity);
+        Reader.Read(UseKeyboard);
+        Reader.Read(ControllerIndex);
+        Reader.Read(RelativeToRotation);
+        Reader.Read(SpeedModifier);
+        Reader.Read(TickLate);
+    }
 }
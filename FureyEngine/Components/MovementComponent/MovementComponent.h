@@ -43,7 +43,10 @@ namespace FureyEngine {
         /** A modifier to apply to movement updates. */
         float SpeedModifier = 1;
 
-        /** Whether to use LateTick() instead of Tick(). */
+        /**
+         * Whether to use LateTick() instead of Tick().<br/>
+         * Call RefreshTickPhases() after changing this once this component has started.
+         */
         bool TickLate = false;
 
         // CONSTRUCTORS
@@ -69,5 +72,24 @@ namespace FureyEngine {
 
         /** Automatically called after this component is removed. */
         void Remove() override;
+
+        // TICK PHASES
+
+        /**
+         * Returns each phase this component should tick in once it has started.<br/>
+         * This component ticks in fixed simulation steps when its world uses a fixed time step.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        /** Returns the state this component reads and writes while it ticks. */
+        [[nodiscard]] TickDependencies GetTickDependencies() const override;
+
+        // SNAPSHOTS
+
+        /** Writes this component's velocity and movement settings to the given snapshot. */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads this component's velocity and movement settings from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
     };
 }
@@ -27,7 +27,7 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(PhysicsComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&PhysicsComponent::SetActive>(this);
 
         if (!BrushComponent) {
             BrushComponent = GetActor()->GetComponent<FureyEngine::BrushComponent>();
@@ -267,10 +267,52 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(PhysicsComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&PhysicsComponent::SetActive>(this);
         }
     }
 
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    // This component ticks in fixed simulation steps when its world uses a fixed time step.
+    TickPhase PhysicsComponent::GetTickPhases() const {
+        return SimulationTickPhase(TickLate ? TickPhase::LATE_TICK : TickPhase::TICK);
+    }
+
+    // SNAPSHOTS
+
+    // Writes this component's velocity and physics settings to the given snapshot.
+    void PhysicsComponent::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Component::Save(Writer);
+
+        Writer.Write(Velocity);
+        Writer.Write(AngularVelocity);
+        Writer.Write(Gravity);
+        Writer.Write(UseGravity);
+        Writer.Write(Friction);
+        Writer.Write(Bounciness);
+        Writer.Write(Mass);
+        Writer.Write(SpeedModifier);
+        Writer.Write(TickLate);
+    }
+
+    // Reads this component's velocity and physics settings from the given snapshot.
+    void PhysicsComponent::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Component::Load(Reader);
+
+        Reader.Read(Velocity);
+        Reader.Read(AngularVelocity);
+        Reader.Read(Gravity);
+        Reader.Read(UseGravity);
+        Reader.Read(Friction);
+        Reader.Read(Bounciness);
+        Reader.Read(Mass);
+        Reader.Read(SpeedModifier);
+        Reader.Read(TickLate);
+    }
+
     // PHYSICS
 
     // Returns this actor's current velocity.
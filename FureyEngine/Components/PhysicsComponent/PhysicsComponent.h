@@ -47,7 +47,10 @@ namespace FureyEngine {
          */
         Delegate<PhysicsComponent *, FureyEngine::BrushComponent *> OnCollision;
 
-        /** Whether to use LateTick() instead of Tick(). */
+        /**
+         * Whether to use LateTick() instead of Tick().<br/>
+         * Call RefreshTickPhases() after changing this once this component has started.
+         */
         bool TickLate = true;
 
         // CONSTRUCTORS
@@ -72,6 +75,22 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         void Remove() override;
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this component should tick in once it has started.<br/>
+         * This component ticks in fixed simulation steps when its world uses a fixed time step.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // SNAPSHOTS
+
+        /** Writes this component's velocity and physics settings to the given snapshot. */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads this component's velocity and physics settings from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
+
         // PHYSICS
 
         /** Returns this actor's current velocity. */
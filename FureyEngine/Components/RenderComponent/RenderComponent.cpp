@@ -21,11 +21,15 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(RenderComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&RenderComponent::SetActive>(this);
 
         // Set the texture's transform to this actor
         MyTexture.Transform = &GetActor()->Transform;
 
+        // Interpolate the texture between its actor's fixed simulation steps
+        MyTexture.PreviousTransform = &GetActor()->GetPreviousTransform();
+        MyTexture.Interpolation = &GetActor()->GetWorld()->GetInterpolation();
+
         // Calls SetActive() to initialize the texture
         SetActive(IsActive());
     }
@@ -36,12 +40,55 @@ namespace FureyEngine {
         Component::Remove();
 
         // Unbind set active from the actor's set active function
-        GetActor()->OnSetActive.Unbind(std::bind(RenderComponent::SetActive, this, std::placeholders::_1));
+        if (BeginTick) {
+            GetActor()->OnSetActive.Unbind<&RenderComponent::SetActive>(this);
+        }
 
         // Call SetActive() to clean up the texture
         SetActive(false);
     }
 
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    // This component does not tick, but derived components tick in every phase in case they override Tick() or
+    // LateTick().
+    // Override this in derived components to only return the phases they tick in.
+    TickPhase RenderComponent::GetTickPhases() const {
+        return typeid(*this) == typeid(RenderComponent) ? TickPhase::NONE : TickPhase::ALL;
+    }
+
+    // SNAPSHOTS
+
+    // Writes this renderer's image name, render mode and target renderers to the given snapshot.
+    // The image must be stored in the engine's images to be saved.
+    void RenderComponent::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Component::Save(Writer);
+
+        Writer.Write(Resources::Images.Find(MyImage));
+        Writer.Write(MyRenderMode);
+        Writer.Write(RenderingLast);
+        Writer.Write(static_cast<unsigned int>(TargetRenderers.size()));
+        for (const auto &Renderer: TargetRenderers) {
+            Writer.Write(Renderer);
+        }
+    }
+
+    // Reads this renderer's image, render mode and target renderers from the given snapshot.
+    void RenderComponent::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Component::Load(Reader);
+
+        MyImage = Resources::Images.Find(Reader.Read<std::string>());
+        Reader.Read(MyRenderMode);
+        Reader.Read(RenderingLast);
+        TargetRenderers.clear();
+        for (auto Count = Reader.Read<unsigned int>(); Count > 0; --Count) {
+            TargetRenderers.insert(Reader.Read<std::string>());
+        }
+    }
+
     // ACTIVITY
 
     // Sets whether this component is active.
@@ -52,7 +99,10 @@ namespace FureyEngine {
 
         if (Active) {
             if (MyTexture.ID == 0 && MyImage != nullptr) {
-                MyTexture = {MyImage->TextureID(), MyImage->TextureSize(), MyTexture.Transform};
+                MyTexture.ID = MyImage->TextureID();
+                MyTexture.Size = MyImage->TextureSize();
+                // Headless builds have no renderers to draw with, so only the size is stored
+#if !HEADLESS
                 if (MyRenderMode == RenderMode::DYNAMIC_TEXTURE) {
                     for (const auto &Renderer: TargetRenderers) {
                         if (RenderingLast) {
@@ -70,6 +120,7 @@ namespace FureyEngine {
                         }
                     }
                 }
+#endif
             }
         } else {
             if (MyTexture.ID != 0) {
@@ -96,7 +147,8 @@ namespace FureyEngine {
                         }
                     }
                 }
-                MyTexture = {0, {0, 0}, MyTexture.Transform};
+                MyTexture.ID = 0;
+                MyTexture.Size = {0, 0};
             }
         }
     }
@@ -52,6 +52,27 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         void Remove() override;
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this component should tick in once it has started.<br/>
+         * This component does not tick, but derived components tick in every phase in case they override Tick() or
+         * LateTick().<br/>
+         * Override this in derived components to only return the phases they tick in.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // SNAPSHOTS
+
+        /**
+         * Writes this renderer's image name, render mode and target renderers to the given snapshot.<br/>
+         * The image must be stored in the engine's images to be saved.
+         */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads this renderer's image, render mode and target renderers from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
+
         // ACTIVITY
 
         /**
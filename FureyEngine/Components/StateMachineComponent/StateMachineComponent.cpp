@@ -26,7 +26,7 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(StateMachineComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&StateMachineComponent::SetActive>(this);
     }
 
     // Automatically called when this component is first created.
@@ -79,13 +79,20 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(StateMachineComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&StateMachineComponent::SetActive>(this);
         }
 
         // Switch to the NULL state
         StateMachineComponent::SwitchState(NULL_STATE);
     }
 
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    TickPhase StateMachineComponent::GetTickPhases() const {
+        return TickLate ? TickPhase::LATE_TICK : TickPhase::TICK;
+    }
+
     // STATE MACHINE
 
     // Returns whether the state machine component's current state is null.
@@ -44,7 +44,10 @@ namespace FureyEngine {
          */
         Delegate<StateMachineComponent *, std::string> OnStateExit;
 
-        /** Whether to use LateTick() instead of Tick(). */
+        /**
+         * Whether to use LateTick() instead of Tick().<br/>
+         * Call RefreshTickPhases() after changing this once this component has started.
+         */
         bool TickLate = false;
 
         // CONSTRUCTORS
@@ -72,6 +75,11 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         void Remove() override;
 
+        // TICK PHASES
+
+        /** Returns each phase this component should tick in once it has started. */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
         // STATE MACHINE
 
         /** Returns whether the state machine component's current state is null. */
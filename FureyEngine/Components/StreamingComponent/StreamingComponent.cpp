@@ -0,0 +1,55 @@
+// .cpp
+// Streaming Component Class Script
+// by Kyle Furey
+
+#include "StreamingComponent.h"
+
+namespace FureyEngine {
+    // CONSTRUCTORS
+
+    // Constructs a new streaming component.
+    StreamingComponent::StreamingComponent(const std::shared_ptr<WorldPartition> &Partition)
+        : Component("Streaming", true), Partition(Partition) {
+    }
+
+    // EVENTS
+
+    // Automatically called before each component has already called Start().
+    void StreamingComponent::Attach() {
+        // Calls the base class's function
+        Component::Attach();
+
+        // Load the cells around the actor before it first ticks
+        if (Partition != nullptr) {
+            Partition->Update(GetFocus());
+        }
+    }
+
+    // Automatically called after each component has already called Tick().
+    void StreamingComponent::LateTick(const double &DeltaTime) {
+        // Calls the base class's function
+        Component::LateTick(DeltaTime);
+
+        // Stream cells around wherever the actor moved this tick
+        if (Partition != nullptr) {
+            Partition->Update(GetFocus());
+        }
+    }
+
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    TickPhase StreamingComponent::GetTickPhases() const {
+        return TickPhase::LATE_TICK;
+    }
+
+    // STREAMING
+
+    // Returns the world position the partition is streamed around.
+    glm::vec2 StreamingComponent::GetFocus() const {
+        if (const auto Camera = GetActor()->GetComponent<CameraComponent>()) {
+            return Camera->Center();
+        }
+        return GetActor()->Transform.Position;
+    }
+}
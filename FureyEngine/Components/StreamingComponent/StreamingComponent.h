@@ -0,0 +1,45 @@
+// .h
+// Streaming Component Class Script
+// by Kyle Furey
+
+#pragma once
+#include "../CameraComponent/CameraComponent.h"
+#include "../../WorldPartition/WorldPartition.h"
+
+namespace FureyEngine {
+    /**
+     * A component that streams the cells of a world partition around its actor.<br/>
+     * The partition is focused on the center of the actor's camera component if it has one, or the actor otherwise.
+     */
+    class StreamingComponent : public Component {
+    public:
+        // STREAMING
+
+        /** The world partition to stream. */
+        std::shared_ptr<WorldPartition> Partition = nullptr;
+
+
+        // CONSTRUCTORS
+
+        /** Constructs a new streaming component. */
+        explicit StreamingComponent(const std::shared_ptr<WorldPartition> &Partition = nullptr);
+
+        // EVENTS
+
+        /** Automatically called before each component has already called Start(). */
+        void Attach() override;
+
+        /** Automatically called after each component has already called Tick(). */
+        void LateTick(const double &DeltaTime) override;
+
+        // TICK PHASES
+
+        /** Returns each phase this component should tick in once it has started. */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // STREAMING
+
+        /** Returns the world position the partition is streamed around. */
+        [[nodiscard]] virtual glm::vec2 GetFocus() const;
+    };
+}
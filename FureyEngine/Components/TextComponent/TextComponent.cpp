@@ -50,11 +50,15 @@ namespace FureyEngine {
         Component::Attach();
 
         // Bind set active to the actor's set active function
-        GetActor()->OnSetActive.Bind(std::bind(TextComponent::SetActive, this, std::placeholders::_1));
+        GetActor()->OnSetActive.Bind<&TextComponent::SetActive>(this);
 
         // Set the texture's transform to this actor
         MyTexture.Transform = &GetActor()->Transform;
 
+        // Interpolate the texture between its actor's fixed simulation steps
+        MyTexture.PreviousTransform = &GetActor()->GetPreviousTransform();
+        MyTexture.Interpolation = &GetActor()->GetWorld()->GetInterpolation();
+
         // Calls SetActive() to initialize the texture
         SetActive(IsActive());
     }
@@ -66,13 +70,67 @@ namespace FureyEngine {
 
         // Unbind set active from the actor's set active function
         if (BeginTick) {
-            GetActor()->OnSetActive.Unbind(std::bind(TextComponent::SetActive, this, std::placeholders::_1));
+            GetActor()->OnSetActive.Unbind<&TextComponent::SetActive>(this);
         }
 
         // Call SetActive() to clean up the texture
         SetActive(false);
     }
 
+    // TICK PHASES
+
+    // Returns each phase this component should tick in once it has started.
+    // This component does not tick, but derived components tick in every phase in case they override Tick() or
+    // LateTick().
+    // Override this in derived components to only return the phases they tick in.
+    TickPhase TextComponent::GetTickPhases() const {
+        return typeid(*this) == typeid(TextComponent) ? TickPhase::NONE : TickPhase::ALL;
+    }
+
+    // SNAPSHOTS
+
+    // Writes this component's font, text, render mode and target renderers to the given snapshot.
+    void TextComponent::Save(SnapshotWriter &Writer) const {
+        // Calls the base class's function
+        Component::Save(Writer);
+
+        Writer.Write(MyFont != nullptr);
+        if (MyFont != nullptr) {
+            Writer.Write(MyFont->Path());
+            Writer.Write(MyFont->Text());
+            Writer.Write(MyFont->Size());
+            Writer.Write(MyFont->Color());
+        }
+        Writer.Write(MyRenderMode);
+        Writer.Write(RenderingLast);
+        Writer.Write(static_cast<unsigned int>(TargetRenderers.size()));
+        for (const auto &Renderer: TargetRenderers) {
+            Writer.Write(Renderer);
+        }
+    }
+
+    // Reads this component's font, text, render mode and target renderers from the given snapshot.
+    void TextComponent::Load(SnapshotReader &Reader) {
+        // Calls the base class's function
+        Component::Load(Reader);
+
+        delete MyFont;
+        MyFont = nullptr;
+        if (Reader.Read<bool>()) {
+            const auto Path = Reader.Read<std::string>();
+            const auto Text = Reader.Read<std::string>();
+            const auto Size = Reader.Read<int>();
+            const auto Color = Reader.Read<SDL_Color>();
+            MyFont = new Font(Path, Text, Size, Color);
+        }
+        Reader.Read(MyRenderMode);
+        Reader.Read(RenderingLast);
+        TargetRenderers.clear();
+        for (auto Count = Reader.Read<unsigned int>(); Count > 0; --Count) {
+            TargetRenderers.insert(Reader.Read<std::string>());
+        }
+    }
+
     // ACTIVITY
 
     // Sets whether this component is active.
@@ -83,7 +141,10 @@ namespace FureyEngine {
 
         if (Active) {
             if (MyTexture.ID == 0 && MyFont != nullptr) {
-                MyTexture = {MyFont->TextureID(), MyFont->TextureSize(), MyTexture.Transform};
+                MyTexture.ID = MyFont->TextureID();
+                MyTexture.Size = MyFont->TextureSize();
+                // Headless builds have no renderers to draw with, so only the size is stored
+#if !HEADLESS
                 if (MyRenderMode == RenderMode::DYNAMIC_TEXTURE) {
                     for (const auto &Renderer: TargetRenderers) {
                         if (RenderingLast) {
@@ -101,6 +162,7 @@ namespace FureyEngine {
                         }
                     }
                 }
+#endif
             }
         } else {
             if (MyTexture.ID != 0) {
@@ -127,7 +189,8 @@ namespace FureyEngine {
                         }
                     }
                 }
-                MyTexture = {0, {0, 0}, MyTexture.Transform};
+                MyTexture.ID = 0;
+                MyTexture.Size = {0, 0};
             }
         }
     }
@@ -71,6 +71,24 @@ namespace FureyEngine {
         /** Automatically called after this component is removed. */
         void Remove() override;
 
+        // TICK PHASES
+
+        /**
+         * Returns each phase this component should tick in once it has started.<br/>
+         * This component does not tick, but derived components tick in every phase in case they override Tick() or
+         * LateTick().<br/>
+         * Override this in derived components to only return the phases they tick in.
+         */
+        [[nodiscard]] TickPhase GetTickPhases() const override;
+
+        // SNAPSHOTS
+
+        /** Writes this component's font, text, render mode and target renderers to the given snapshot. */
+        void Save(SnapshotWriter &Writer) const override;
+
+        /** Reads this component's font, text, render mode and target renderers from the given snapshot. */
+        void Load(SnapshotReader &Reader) override;
+
         // ACTIVITY
 
         /**
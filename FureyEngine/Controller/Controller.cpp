@@ -13,8 +13,7 @@ namespace FureyEngine {
         // Attempts to bind to a new controller
         if (!BindInput()) {
             // Awaits the next connection
-            Input::Events[SDL_CONTROLLERDEVICEADDED].Bind
-                    (std::bind(&Controller::OnConnect, this, std::placeholders::_1));
+            Input::Events[SDL_CONTROLLERDEVICEADDED].Bind<&Controller::OnConnect>(this);
         }
 
         ++TotalControllers;
@@ -32,8 +31,7 @@ namespace FureyEngine {
         // Attempts to bind to a new controller
         if (!BindInput()) {
             // Awaits the next connection
-            Input::Events[SDL_CONTROLLERDEVICEADDED].Bind
-                    (std::bind(&Controller::OnConnect, this, std::placeholders::_1));
+            Input::Events[SDL_CONTROLLERDEVICEADDED].Bind<&Controller::OnConnect>(this);
         }
 
         ++TotalControllers;
@@ -125,16 +123,11 @@ namespace FureyEngine {
         ConnectEvent(JoystickID);
 
         // Bind all events
-        Input::Events[SDL_CONTROLLERBUTTONDOWN].
-                Bind(std::bind(&Controller::OnButtonDown, this, std::placeholders::_1));
-        Input::Events[SDL_CONTROLLERBUTTONUP].
-                Bind(std::bind(&Controller::OnButtonUp, this, std::placeholders::_1));
-        Input::Events[SDL_CONTROLLERAXISMOTION].
-                Bind(std::bind(&Controller::OnMoveAxis, this, std::placeholders::_1));
-        Input::Events[SDL_CONTROLLERDEVICEREMOVED].
-                Bind(std::bind(&Controller::OnDisconnect, this, std::placeholders::_1));
-        Input::UpdateEvents.
-                Bind(std::bind(&Controller::Update, this, std::placeholders::_1));
+        Input::Events[SDL_CONTROLLERBUTTONDOWN].Bind<&Controller::OnButtonDown>(this);
+        Input::Events[SDL_CONTROLLERBUTTONUP].Bind<&Controller::OnButtonUp>(this);
+        Input::Events[SDL_CONTROLLERAXISMOTION].Bind<&Controller::OnMoveAxis>(this);
+        Input::Events[SDL_CONTROLLERDEVICEREMOVED].Bind<&Controller::OnDisconnect>(this);
+        Input::UpdateEvents.Bind<&Controller::Update>(this);
 
         return true;
     }
@@ -143,31 +136,13 @@ namespace FureyEngine {
     void Controller::UnbindInput() {
         // Unbind all events
         if (MyController == nullptr) {
-            Input::Cleanup.Bind([&] {
-                Input::Events[SDL_CONTROLLERDEVICEADDED].Unbind
-                        (std::bind(&Controller::OnDisconnect, this, std::placeholders::_1));
-            });
+            Input::Events[SDL_CONTROLLERDEVICEADDED].Unbind<&Controller::OnConnect>(this);
         } else {
-            Input::Cleanup.Bind([&] {
-                Input::UpdateEvents.Unbind
-                        (std::bind(&Controller::Update, this, std::placeholders::_1));
-            });
-            Input::Cleanup.Bind([&] {
-                Input::Events[SDL_CONTROLLERDEVICEREMOVED].Unbind
-                        (std::bind(&Controller::OnDisconnect, this, std::placeholders::_1));
-            });
-            Input::Cleanup.Bind([&] {
-                Input::Events[SDL_CONTROLLERAXISMOTION].Unbind
-                        (std::bind(&Controller::OnMoveAxis, this, std::placeholders::_1));
-            });
-            Input::Cleanup.Bind([&] {
-                Input::Events[SDL_CONTROLLERBUTTONUP].Unbind
-                        (std::bind(&Controller::OnButtonUp, this, std::placeholders::_1));
-            });
-            Input::Cleanup.Bind([&] {
-                Input::Events[SDL_CONTROLLERBUTTONDOWN].Unbind
-                        (std::bind(&Controller::OnButtonDown, this, std::placeholders::_1));
-            });
+            Input::UpdateEvents.Unbind<&Controller::Update>(this);
+            Input::Events[SDL_CONTROLLERDEVICEREMOVED].Unbind<&Controller::OnDisconnect>(this);
+            Input::Events[SDL_CONTROLLERAXISMOTION].Unbind<&Controller::OnMoveAxis>(this);
+            Input::Events[SDL_CONTROLLERBUTTONUP].Unbind<&Controller::OnButtonUp>(this);
+            Input::Events[SDL_CONTROLLERBUTTONDOWN].Unbind<&Controller::OnButtonDown>(this);
 
             // Call disconnection events
             DisconnectEvent(JoystickID);
@@ -186,10 +161,7 @@ namespace FureyEngine {
         // Check for a successful binding
         if (BindInput()) {
             // Stop waiting for another connection
-            Input::Cleanup.Bind([&] {
-                Input::Events[SDL_CONTROLLERDEVICEADDED].Unbind
-                        (std::bind(&Controller::OnConnect, this, std::placeholders::_1));
-            });
+            Input::Events[SDL_CONTROLLERDEVICEADDED].Unbind<&Controller::OnConnect>(this);
         }
     }
 
@@ -200,8 +172,7 @@ namespace FureyEngine {
             UnbindInput();
 
             // Awaits the next connection
-            Input::Events[SDL_CONTROLLERDEVICEADDED].Bind
-                    (std::bind(&Controller::OnConnect, this, std::placeholders::_1));
+            Input::Events[SDL_CONTROLLERDEVICEADDED].Bind<&Controller::OnConnect>(this);
         }
     }
 
@@ -0,0 +1,319 @@
+// .cpp
+// Coroutine Scripting Script
+// by Kyle Furey
+
+#include "Coroutine.h"
+
+namespace FureyEngine {
+    // ALLOCATION
+
+    // Allocates a coroutine frame of the given size from its size class pool.
+    void *Coroutine::promise_type::operator new(const size_t Size) {
+        if (SizeClassPool::IsPooled(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__)) {
+            return SizeClassPool::ForSize(Size).Allocate();
+        }
+        return ::operator new(Size);
+    }
+
+    // Returns the given coroutine frame to its size class pool.
+    void Coroutine::promise_type::operator delete(void *Frame, const size_t Size) {
+        if (SizeClassPool::IsPooled(Size, __STDCPP_DEFAULT_NEW_ALIGNMENT__)) {
+            SizeClassPool::ForSize(Size).Deallocate(Frame);
+        } else {
+            ::operator delete(Frame);
+        }
+    }
+
+    // COROUTINE
+
+    // Returns the coroutine of this promise.
+    Coroutine Coroutine::promise_type::get_return_object() {
+        return Coroutine(CoroutineFrame::from_promise(*this));
+    }
+
+    // Suspends a new coroutine until it is started.
+    std::suspend_always Coroutine::promise_type::initial_suspend() const noexcept {
+        return {};
+    }
+
+    // Suspends a finished coroutine so its scheduler can destroy it.
+    std::suspend_always Coroutine::promise_type::final_suspend() const noexcept {
+        return {};
+    }
+
+    // Finishes the coroutine.
+    void Coroutine::promise_type::return_void() const noexcept {
+    }
+
+    // Stores the thrown exception so its scheduler can rethrow it once the coroutine is destroyed.
+    void Coroutine::promise_type::unhandled_exception() {
+        Exception = std::current_exception();
+    }
+
+    // Constructs a new coroutine that owns the given frame.
+    Coroutine::Coroutine(const std::coroutine_handle<promise_type> &Frame)
+        : Frame(Frame) {
+    }
+
+    // CONSTRUCTORS
+
+    // Moves the given coroutine's frame into a new coroutine.
+    Coroutine::Coroutine(Coroutine &&Moved) noexcept
+        : Frame(std::exchange(Moved.Frame, nullptr)) {
+    }
+
+    // ASSIGNMENT OPERATORS
+
+    // Moves the given coroutine's frame into this coroutine.
+    Coroutine &Coroutine::operator=(Coroutine &&Moved) noexcept {
+        if (this != &Moved) {
+            if (Frame) {
+                Frame.destroy();
+            }
+            Frame = std::exchange(Moved.Frame, nullptr);
+        }
+        return *this;
+    }
+
+    // DESTRUCTOR
+
+    // Destroys this coroutine's frame if it was never started.
+    Coroutine::~Coroutine() {
+        if (Frame) {
+            Frame.destroy();
+        }
+    }
+
+    // VALIDITY
+
+    // Returns whether this coroutine can be started.
+    bool Coroutine::IsValid() const {
+        return static_cast<bool>(Frame);
+    }
+
+    // SECONDS
+
+    // Waits for the given number of seconds.
+    Seconds::Seconds(const double &Delay)
+        : Delay(Delay) {
+    }
+
+    // Always suspends, so waiting 0 seconds resumes on the next tick.
+    bool Seconds::await_ready() const noexcept {
+        return false;
+    }
+
+    // Schedules the given coroutine to be resumed once the delay has passed.
+    void Seconds::await_suspend(const CoroutineFrame &Frame) const {
+        auto &Promise = Frame.promise();
+        Promise.Timer = Promise.Scheduler->Timers.Schedule(Delay, 0, 1, [Frame] {
+            Frame.promise().Timer = {};
+
+            // Keep the exception until each due coroutine has resumed, since throwing stops the wheel firing them
+            CoroutineScheduler *const Scheduler = Frame.promise().Scheduler;
+            try {
+                CoroutineScheduler::Resume(Frame);
+            } catch (...) {
+                if (Scheduler->Thrown == nullptr) {
+                    Scheduler->Thrown = std::current_exception();
+                }
+            }
+        });
+    }
+
+    // Returns nothing once the delay has passed.
+    void Seconds::await_resume() const noexcept {
+    }
+
+    // NEXT TICK
+
+    // Always suspends.
+    bool NextTick::await_ready() const noexcept {
+        return false;
+    }
+
+    // Schedules the given coroutine to be resumed next tick.
+    void NextTick::await_suspend(const CoroutineFrame &Frame) const {
+        Seconds(0).await_suspend(Frame);
+    }
+
+    // Returns nothing once the next tick has started.
+    void NextTick::await_resume() const noexcept {
+    }
+
+    // NEXT INVOKE
+
+    // Suspends a coroutine until the given event is next invoked.
+    InvokeAwaiter<Event> NextInvoke(Event &Target) {
+        return InvokeAwaiter<Event>(Target);
+    }
+
+    // SCHEDULER
+
+    // Cancels what the given coroutine is waiting for.
+    void CoroutineScheduler::CancelWaits(Coroutine::promise_type &Promise) {
+        if (Promise.Timer.Generation != 0) {
+            Promise.Scheduler->Timers.Cancel(Promise.Timer);
+            Promise.Timer = {};
+        }
+        if (Promise.CancelWait != nullptr) {
+            const auto CancelWait = std::exchange(Promise.CancelWait, nullptr);
+            CancelWait(std::exchange(Promise.Awaiter, nullptr));
+        }
+    }
+
+    // Destroys the given coroutine's frame and frees its slot.
+    void CoroutineScheduler::Finish(const unsigned int &Index) {
+        // Free the slot first since destroying the frame's local variables may start or stop other coroutines
+        Running &Finished = Coroutines[Index];
+        const CoroutineFrame Frame = Finished.Frame;
+        Finished.Frame = nullptr;
+        ++Finished.Generation;
+        Finished.NextFree = FirstFree;
+        FirstFree = static_cast<int>(Index);
+        --RunningCount;
+        Frame.destroy();
+    }
+
+    // DESTRUCTOR
+
+    // Stops each coroutine.
+    CoroutineScheduler::~CoroutineScheduler() {
+        Clear();
+    }
+
+    // START
+
+    // Starts the given coroutine, which runs until it first suspends before this returns.
+    // If an owner is given, the coroutine is stopped instead of resumed once its owner is destroyed.
+    // Returns a handle that stops the coroutine when passed to Stop().
+    CoroutineHandle CoroutineScheduler::Start(Coroutine Script, const ReferenceHandle &Owner) {
+        if (!Script.IsValid()) {
+            throw std::runtime_error("ERROR: Attempted to start an invalid coroutine!");
+        }
+        const CoroutineFrame Frame = std::exchange(Script.Frame, nullptr);
+
+        int Index = FirstFree;
+        if (Index != -1) {
+            FirstFree = Coroutines[Index].NextFree;
+        } else {
+            Index = static_cast<int>(Coroutines.size());
+            Coroutines.emplace_back();
+        }
+        Running &Started = Coroutines[Index];
+        Started.Frame = Frame;
+        Started.NextFree = -1;
+        ++RunningCount;
+
+        auto &Promise = Frame.promise();
+        Promise.Scheduler = this;
+        Promise.Index = static_cast<unsigned int>(Index);
+        Promise.Owner = Owner;
+
+        const CoroutineHandle Handle = {static_cast<unsigned int>(Index), Started.Generation};
+        Resume(Frame);
+        return Handle;
+    }
+
+    // Stops the coroutine with the given handle, destroying its frame and each of its local variables.
+    // A coroutine that stops itself is stopped once it next suspends.
+    // Returns whether the coroutine was still running.
+    bool CoroutineScheduler::Stop(const CoroutineHandle &Handle) {
+        if (!IsRunning(Handle)) {
+            return false;
+        }
+        auto &Promise = Coroutines[Handle.Index].Frame.promise();
+        if (Promise.Resuming) {
+            Promise.Stopping = true;
+            return true;
+        }
+        CancelWaits(Promise);
+        Finish(Handle.Index);
+        return true;
+    }
+
+    // Stops each coroutine owned by the object with the given handle.
+    // Returns the number of coroutines that were still running.
+    int CoroutineScheduler::StopOwned(const ReferenceHandle &Owner) {
+        if (Owner.Generation == 0) {
+            return 0;
+        }
+        int Stopped = 0;
+        for (size_t i = 0; i < Coroutines.size(); ++i) {
+            if (Coroutines[i].Frame == nullptr) {
+                continue;
+            }
+            const auto &Promise = Coroutines[i].Frame.promise();
+            if (Promise.Owner.Index == Owner.Index && Promise.Owner.Generation == Owner.Generation &&
+                Stop({static_cast<unsigned int>(i), Coroutines[i].Generation})) {
+                ++Stopped;
+            }
+        }
+        return Stopped;
+    }
+
+    // Returns whether the coroutine with the given handle is still running.
+    bool CoroutineScheduler::IsRunning(const CoroutineHandle &Handle) const {
+        return Handle.Generation != 0 && Handle.Index < Coroutines.size() &&
+               Coroutines[Handle.Index].Generation == Handle.Generation &&
+               Coroutines[Handle.Index].Frame != nullptr;
+    }
+
+    // Resumes the given suspended coroutine, then destroys it if it finished or was stopped.
+    // Rethrows any exception the coroutine threw.
+    void CoroutineScheduler::Resume(const CoroutineFrame &Frame) {
+        auto &Promise = Frame.promise();
+        CoroutineScheduler *const Scheduler = Promise.Scheduler;
+
+        // Coroutines are not resumed after their owner is destroyed since they may use it
+        if (Promise.Owner.Generation == 0 || ReferenceRegistry::IsValid(Promise.Owner)) {
+            Promise.Resuming = true;
+            Frame.resume();
+            Promise.Resuming = false;
+            if (!Frame.done() && !Promise.Stopping) {
+                return;
+            }
+        }
+
+        CancelWaits(Promise);
+        const auto Exception = Promise.Exception;
+        Scheduler->Finish(Promise.Index);
+        if (Exception != nullptr) {
+            std::rethrow_exception(Exception);
+        }
+    }
+
+    // ADVANCE
+
+    // Advances this scheduler by the given number of seconds and resumes each coroutine whose wait is over.
+    // Each due coroutine is resumed even if another throws, then the first exception thrown is rethrown.
+    void CoroutineScheduler::Advance(const double &DeltaTime) {
+        if (Advancing) {
+            return;
+        }
+        Advancing = true;
+        Timers.Advance(DeltaTime);
+        Advancing = false;
+        if (Thrown != nullptr) {
+            std::rethrow_exception(std::exchange(Thrown, nullptr));
+        }
+    }
+
+    // COUNT
+
+    // Returns the number of running coroutines.
+    int CoroutineScheduler::Count() const {
+        return RunningCount;
+    }
+
+    // CLEAR
+
+    // Stops each coroutine.
+    void CoroutineScheduler::Clear() {
+        for (size_t i = 0; i < Coroutines.size(); ++i) {
+            if (Coroutines[i].Frame != nullptr) {
+                Stop({static_cast<unsigned int>(i), Coroutines[i].Generation});
+            }
+        }
+    }
+}
@@ -0,0 +1,417 @@
+// .h
+// Coroutine Scripting Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+#include "../Delegate/Delegate.h"
+#include "../Event/Event.h"
+#include "../PoolAllocator/PoolAllocator.h"
+#include "../Reference/Reference.h"
+#include "../TimerWheel/TimerWheel.h"
+
+namespace FureyEngine {
+    // Forward declaration of a coroutine scheduler.
+    class CoroutineScheduler;
+
+    /** Identifies a coroutine started in a coroutine scheduler so it can be stopped later. */
+    struct CoroutineHandle final {
+        /** The index of the coroutine in its scheduler. */
+        unsigned int Index = 0;
+
+        /** The generation of the coroutine when it was started, or 0 if this handle is null. */
+        unsigned int Generation = 0;
+    };
+
+    /**
+     * A script that can wait for time to pass or a delegate to be invoked without blocking its world.<br/>
+     * Any function returning a coroutine may co_await Seconds(), NextTick() or NextInvoke() to suspend itself,<br/>
+     * and is resumed by its scheduler once that wait is over instead of being checked every tick.<br/>
+     * Each coroutine's frame is allocated from the size class pool of its size.<br/>
+     * A coroutine does nothing until it is started with World::StartCoroutine().
+     */
+    class Coroutine final {
+    public:
+        /** The state of a coroutine shared with its scheduler and what it is waiting for. */
+        struct promise_type final {
+            // SCHEDULER
+
+            /** The scheduler running this coroutine, or nullptr if it has not been started. */
+            CoroutineScheduler *Scheduler = nullptr;
+
+            /** The index of this coroutine in its scheduler. */
+            unsigned int Index = 0;
+
+            /** The handle of the object that owns this coroutine, or a null handle if it is not owned. */
+            ReferenceHandle Owner;
+
+            /** Whether this coroutine is running. */
+            bool Resuming = false;
+
+            /** Whether this coroutine was stopped while running and is stopped once it next suspends. */
+            bool Stopping = false;
+
+            /** The exception thrown by this coroutine, which is rethrown by its scheduler. */
+            std::exception_ptr Exception = nullptr;
+
+            // WAITS
+
+            /** The timer that resumes this coroutine, or a null handle if it is not waiting for time. */
+            TimerHandle Timer;
+
+            /** Stops the given awaiter from resuming this coroutine, or nullptr if it is not waiting for an invoke. */
+            void (*CancelWait)(void *Awaiter) = nullptr;
+
+            /** The awaiter this coroutine is waiting for an invoke of. */
+            void *Awaiter = nullptr;
+
+            // ALLOCATION
+
+            /** Allocates a coroutine frame of the given size from its size class pool. */
+            [[nodiscard]] static void *operator new(size_t Size);
+
+            /** Returns the given coroutine frame to its size class pool. */
+            static void operator delete(void *Frame, size_t Size);
+
+            // COROUTINE
+
+            /** Returns the coroutine of this promise. */
+            [[nodiscard]] Coroutine get_return_object();
+
+            /** Suspends a new coroutine until it is started. */
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept;
+
+            /** Suspends a finished coroutine so its scheduler can destroy it. */
+            [[nodiscard]] std::suspend_always final_suspend() const noexcept;
+
+            /** Finishes the coroutine. */
+            void return_void() const noexcept;
+
+            /** Stores the thrown exception so its scheduler can rethrow it once the coroutine is destroyed. */
+            void unhandled_exception();
+        };
+
+    private:
+        /** The frame of this coroutine, or nullptr if it was started or moved. */
+        std::coroutine_handle<promise_type> Frame;
+
+        /** Constructs a new coroutine that owns the given frame. */
+        explicit Coroutine(const std::coroutine_handle<promise_type> &Frame);
+
+        friend class CoroutineScheduler;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Delete copy constructor. */
+        Coroutine(const Coroutine &Copied) = delete;
+
+        /** Moves the given coroutine's frame into a new coroutine. */
+        Coroutine(Coroutine &&Moved) noexcept;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        Coroutine &operator=(const Coroutine &Copied) = delete;
+
+        /** Moves the given coroutine's frame into this coroutine. */
+        Coroutine &operator=(Coroutine &&Moved) noexcept;
+
+        // DESTRUCTOR
+
+        /** Destroys this coroutine's frame if it was never started. */
+        ~Coroutine();
+
+        // VALIDITY
+
+        /** Returns whether this coroutine can be started. */
+        [[nodiscard]] bool IsValid() const;
+    };
+
+    /** The handle of a coroutine's frame. */
+    using CoroutineFrame = std::coroutine_handle<Coroutine::promise_type>;
+
+    /** Suspends a coroutine for the given number of seconds of its world's time. */
+    struct Seconds final {
+        /** The number of seconds to wait. */
+        double Delay = 0;
+
+        /** Waits for the given number of seconds. */
+        explicit Seconds(const double &Delay);
+
+        /** Always suspends, so waiting 0 seconds resumes on the next tick. */
+        [[nodiscard]] bool await_ready() const noexcept;
+
+        /** Schedules the given coroutine to be resumed once the delay has passed. */
+        void await_suspend(const CoroutineFrame &Frame) const;
+
+        /** Returns nothing once the delay has passed. */
+        void await_resume() const noexcept;
+    };
+
+    /** Suspends a coroutine until its world's next tick. */
+    struct NextTick final {
+        /** Always suspends. */
+        [[nodiscard]] bool await_ready() const noexcept;
+
+        /** Schedules the given coroutine to be resumed next tick. */
+        void await_suspend(const CoroutineFrame &Frame) const;
+
+        /** Returns nothing once the next tick has started. */
+        void await_resume() const noexcept;
+    };
+
+    /**
+     * Suspends a coroutine until the given delegate or event is next invoked, then returns its arguments.<br/>
+     * Nothing is returned for no arguments, one argument is returned by value and several are returned as a tuple.<br/>
+     * The coroutine is resumed immediately by the invoke, and the delegate may be invoked on the world's thread only.<br/>
+     * If the delegate is destroyed first, the coroutine waits until it is stopped.
+     */
+    template<typename TargetType, typename... ArgumentTypes>
+    class InvokeAwaiter final {
+        /** The function bound to the awaited delegate, which resumes the coroutine once. */
+        class Binding final {
+            /** The awaiter to resume, or nullptr if this binding is a copy or has already resumed it. */
+            InvokeAwaiter *Awaiter = nullptr;
+
+        public:
+            /** Binds to the given awaiter. */
+            explicit Binding(InvokeAwaiter *Awaiter) : Awaiter(Awaiter) {
+            }
+
+            /** Copies never resume the awaiter, so copying the delegate does not resume it twice. */
+            Binding(const Binding &) {
+            }
+
+            /** Moves the given binding and tells the awaiter where it now is. */
+            Binding(Binding &&Moved) noexcept : Awaiter(std::exchange(Moved.Awaiter, nullptr)) {
+                if (Awaiter != nullptr) {
+                    Awaiter->Bound = this;
+                }
+            }
+
+            /** Delete copy constructor. */
+            Binding &operator=(const Binding &Copied) = delete;
+
+            /** Delete move constructor. */
+            Binding &operator=(Binding &&Moved) = delete;
+
+            /** Tells the awaiter this binding no longer exists so it is not unbound twice. */
+            ~Binding() {
+                if (Awaiter != nullptr) {
+                    Awaiter->Bound = nullptr;
+                }
+            }
+
+            /** Stores the arguments and resumes the awaiting coroutine. */
+            void operator()(ArgumentTypes... Arguments);
+
+            friend class InvokeAwaiter;
+        };
+
+        /** The delegate or event being awaited. */
+        TargetType &Target;
+
+        /** The handle of the binding in the delegate. */
+        DelegateHandle Handle = 0;
+
+        /** The binding in the delegate, or nullptr if it has been unbound or destroyed. */
+        Binding *Bound = nullptr;
+
+        /** The awaiting coroutine. */
+        CoroutineFrame Frame;
+
+        /** The arguments of the invoke, once it has happened. */
+        std::optional<std::tuple<std::decay_t<ArgumentTypes>...> > Result;
+
+        /** Unbinds the given awaiter from its delegate so it does not resume its stopped coroutine. */
+        static void Cancel(void *Awaiter) {
+            const auto Cancelled = static_cast<InvokeAwaiter *>(Awaiter);
+            if (Cancelled->Bound != nullptr) {
+                Cancelled->Bound->Awaiter = nullptr;
+                Cancelled->Bound = nullptr;
+                if (Cancelled->Target.IsBound(Cancelled->Handle)) {
+                    Cancelled->Target.Unbind(Cancelled->Handle);
+                }
+            }
+        }
+
+    public:
+        /** Waits for the given delegate or event to be invoked. */
+        explicit InvokeAwaiter(TargetType &Target) : Target(Target) {
+        }
+
+        /** Always suspends. */
+        [[nodiscard]] bool await_ready() const noexcept {
+            return false;
+        }
+
+        /** Binds the given coroutine to be resumed by the next invoke. */
+        void await_suspend(const CoroutineFrame &Frame) {
+            this->Frame = Frame;
+            Handle = Target.Bind(Binding(this));
+            auto &Promise = Frame.promise();
+            Promise.CancelWait = &Cancel;
+            Promise.Awaiter = this;
+        }
+
+        /** Returns the arguments of the invoke. */
+        auto await_resume() {
+            if constexpr (sizeof...(ArgumentTypes) == 1) {
+                return std::move(std::get<0>(*Result));
+            } else if constexpr (sizeof...(ArgumentTypes) > 1) {
+                return std::move(*Result);
+            }
+        }
+    };
+
+    /** Suspends a coroutine until the given delegate is next invoked, then returns its arguments. */
+    template<typename... ArgumentTypes>
+    [[nodiscard]] InvokeAwaiter<Delegate<ArgumentTypes...>, ArgumentTypes...> NextInvoke(
+        Delegate<ArgumentTypes...> &Target) {
+        return InvokeAwaiter<Delegate<ArgumentTypes...>, ArgumentTypes...>(Target);
+    }
+
+    /** Suspends a coroutine until the given event is next invoked. */
+    [[nodiscard]] InvokeAwaiter<Event> NextInvoke(Event &Target);
+
+    /**
+     * Runs coroutines and resumes each one once what it is waiting for is over.<br/>
+     * Coroutines waiting for time are parked in a timing wheel, and coroutines waiting for a delegate are bound to it,<br/>
+     * so suspended coroutines cost nothing each tick no matter how many there are.<br/>
+     * NOTE: Coroutines must be started, stopped and resumed on the thread that advances the scheduler.
+     */
+    class CoroutineScheduler final {
+        /** A running coroutine. */
+        struct Running final {
+            /** The frame of this coroutine, or nullptr if this slot is free. */
+            CoroutineFrame Frame = nullptr;
+
+            /** The current generation of this slot, which is incremented each time its coroutine finishes. */
+            unsigned int Generation = 1;
+
+            /** The next free slot, or -1. */
+            int NextFree = -1;
+        };
+
+        /** Each running coroutine. */
+        std::vector<Running> Coroutines;
+
+        /** The first free slot, or -1. */
+        int FirstFree = -1;
+
+        /** The number of running coroutines. */
+        int RunningCount = 0;
+
+        /** Resumes coroutines waiting for time. */
+        TimerWheel Timers;
+
+        /** Whether this scheduler is resuming each coroutine whose wait is over. */
+        bool Advancing = false;
+
+        /** The first exception thrown by a coroutine while advancing, which is rethrown once advancing is done. */
+        std::exception_ptr Thrown = nullptr;
+
+        /** Cancels what the given coroutine is waiting for. */
+        static void CancelWaits(Coroutine::promise_type &Promise);
+
+        /** Destroys the given coroutine's frame and frees its slot. */
+        void Finish(const unsigned int &Index);
+
+        friend struct Seconds;
+        friend struct NextTick;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new scheduler with no coroutines. */
+        CoroutineScheduler() = default;
+
+        /** Delete copy constructor. */
+        CoroutineScheduler(const CoroutineScheduler &Copied) = delete;
+
+        /** Delete move constructor. */
+        CoroutineScheduler(CoroutineScheduler &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        CoroutineScheduler &operator=(const CoroutineScheduler &Copied) = delete;
+
+        /** Delete move constructor. */
+        CoroutineScheduler &operator=(CoroutineScheduler &&Moved) = delete;
+
+        // DESTRUCTOR
+
+        /** Stops each coroutine. */
+        ~CoroutineScheduler();
+
+        // START
+
+        /**
+         * Starts the given coroutine, which runs until it first suspends before this returns.<br/>
+         * If an owner is given, the coroutine is stopped instead of resumed once its owner is destroyed.<br/>
+         * Returns a handle that stops the coroutine when passed to Stop().
+         */
+        CoroutineHandle Start(Coroutine Script, const ReferenceHandle &Owner = {});
+
+        /**
+         * Stops the coroutine with the given handle, destroying its frame and each of its local variables.<br/>
+         * A coroutine that stops itself is stopped once it next suspends.<br/>
+         * Returns whether the coroutine was still running.
+         */
+        bool Stop(const CoroutineHandle &Handle);
+
+        /**
+         * Stops each coroutine owned by the object with the given handle.<br/>
+         * Returns the number of coroutines that were still running.
+         */
+        int StopOwned(const ReferenceHandle &Owner);
+
+        /** Returns whether the coroutine with the given handle is still running. */
+        [[nodiscard]] bool IsRunning(const CoroutineHandle &Handle) const;
+
+        /**
+         * Resumes the given suspended coroutine, then destroys it if it finished or was stopped.<br/>
+         * Rethrows any exception the coroutine threw.
+         */
+        static void Resume(const CoroutineFrame &Frame);
+
+        // ADVANCE
+
+        /**
+         * Advances this scheduler by the given number of seconds and resumes each coroutine whose wait is over.<br/>
+         * Each due coroutine is resumed even if another throws, then the first exception thrown is rethrown.
+         */
+        void Advance(const double &DeltaTime);
+
+        // COUNT
+
+        /** Returns the number of running coroutines. */
+        [[nodiscard]] int Count() const;
+
+        // CLEAR
+
+        /** Stops each coroutine. */
+        void Clear();
+    };
+
+    // COROUTINES
+
+    // Stores the arguments and resumes the awaiting coroutine.
+    template<typename TargetType, typename... ArgumentTypes>
+    void InvokeAwaiter<TargetType, ArgumentTypes...>::Binding::operator()(ArgumentTypes... Arguments) {
+        if (Awaiter == nullptr) {
+            return;
+        }
+
+        // Only the first invoke resumes the coroutine, which may immediately wait for this delegate again
+        InvokeAwaiter *const Resumed = std::exchange(Awaiter, nullptr);
+        Resumed->Bound = nullptr;
+        Resumed->Frame.promise().CancelWait = nullptr;
+        Resumed->Frame.promise().Awaiter = nullptr;
+        Resumed->Target.Unbind(Resumed->Handle);
+        Resumed->Result.emplace(Arguments...);
+        CoroutineScheduler::Resume(Resumed->Frame);
+    }
+}
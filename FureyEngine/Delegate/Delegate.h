@@ -5,65 +5,390 @@
 #pragma once
 #include "../Standard/Standard.h"
 
+// The number of bytes each bound function can be stored in without a separate allocation.
+#define DELEGATE_INLINE_BYTES 32
+
 namespace FureyEngine {
+    /**
+     * Identifies a function bound to a delegate or event so it can be unbound later.<br/>
+     * Handles are never reused by the same delegate, and 0 is never a valid handle.
+     */
+    using DelegateHandle = uint64_t;
+
     /**
      * Represents a collection of void returning functions that can be bound<br/>
-     * and called simultaneously with parameters.
+     * and called simultaneously with parameters.<br/>
+     * Bound functions small enough are stored inline without allocating, and each binding returns a handle to unbind it.<br/>
+     * Functions can be bound and unbound while this delegate is invoking.<br/>
+     * Functions bound while invoking are first called the next time this delegate is invoked.
      */
     template<typename... ArgumentTypes>
     class Delegate {
         // FUNCTIONS
 
-        /** Each of the functions bound to this delegate. */
-        std::vector<std::function<void(ArgumentTypes...)> > Functions;
+        /** An operation performed on a bound function's storage. */
+        enum class StorageOperation {
+            /** Copy constructs the source function into the storage. */
+            COPY,
+
+            /** Move constructs the source function into the storage. */
+            MOVE,
+
+            /** Destroys the function in the storage. */
+            DESTROY
+        };
+
+        /** A function bound to a delegate, stored inline when it is small enough and otherwise allocated. */
+        struct BoundFunction final {
+            /** The handle of this function. */
+            DelegateHandle Handle = 0;
+
+            /** Calls the function in the storage, or nullptr if this function was unbound while invoking. */
+            void (*Call)(void *Storage, ArgumentTypes... Arguments) = nullptr;
+
+            /** Copies, moves or destroys the function in the storage, or nullptr if it is trivially copyable. */
+            void (*Manage)(StorageOperation Operation, void *Storage, void *Source) = nullptr;
+
+            /** The function, or a pointer to it if it does not fit. */
+            alignas(void *) unsigned char Storage[DELEGATE_INLINE_BYTES] = {};
+
+            /** Constructs a new empty bound function. */
+            BoundFunction() = default;
+
+            /** Copies the given bound function. */
+            BoundFunction(const BoundFunction &Copied) {
+                Assign(Copied, StorageOperation::COPY);
+            }
+
+            /** Moves the given bound function. */
+            BoundFunction(BoundFunction &&Moved) noexcept {
+                Assign(Moved, StorageOperation::MOVE);
+            }
+
+            /** Copies the given bound function. */
+            BoundFunction &operator=(const BoundFunction &Copied) {
+                if (this != &Copied) {
+                    Destroy();
+                    Assign(Copied, StorageOperation::COPY);
+                }
+                return *this;
+            }
+
+            /** Moves the given bound function. */
+            BoundFunction &operator=(BoundFunction &&Moved) noexcept {
+                if (this != &Moved) {
+                    Destroy();
+                    Assign(Moved, StorageOperation::MOVE);
+                }
+                return *this;
+            }
+
+            /** Destroys the stored function. */
+            ~BoundFunction() {
+                Destroy();
+            }
+
+            /** Copies or moves the given bound function into this empty one. */
+            void Assign(const BoundFunction &Other, const StorageOperation &Operation) {
+                Handle = Other.Handle;
+                Call = Other.Call;
+                Manage = Other.Manage;
+                if (Manage != nullptr) {
+                    Manage(Operation, Storage, const_cast<unsigned char *>(Other.Storage));
+                } else {
+                    std::memcpy(Storage, Other.Storage, DELEGATE_INLINE_BYTES);
+                }
+            }
+
+            /** Destroys the stored function. */
+            void Destroy() {
+                if (Manage != nullptr) {
+                    Manage(StorageOperation::DESTROY, Storage, nullptr);
+                    Manage = nullptr;
+                }
+                Call = nullptr;
+            }
+
+            /** Stores the given function, inline if it fits. */
+            template<typename FunctionType, typename StoredType = std::decay_t<FunctionType> >
+            void Store(FunctionType &&Function) {
+                if constexpr (sizeof(StoredType) <= DELEGATE_INLINE_BYTES && alignof(StoredType) <= alignof(void *) &&
+                              std::is_nothrow_move_constructible_v<StoredType>) {
+                    new(Storage) StoredType(std::forward<FunctionType>(Function));
+                    Call = [](void *Storage, ArgumentTypes... Arguments) {
+                        std::invoke(*std::launder(static_cast<StoredType *>(Storage)), Arguments...);
+                    };
+                    if constexpr (!std::is_trivially_copyable_v<StoredType>) {
+                        Manage = [](const StorageOperation Operation, void *Storage, void *Source) {
+                            switch (Operation) {
+                                case StorageOperation::COPY:
+                                    new(Storage) StoredType(*std::launder(static_cast<StoredType *>(Source)));
+                                    break;
+                                case StorageOperation::MOVE:
+                                    new(Storage) StoredType(std::move(*std::launder(static_cast<StoredType *>(Source))));
+                                    break;
+                                case StorageOperation::DESTROY:
+                                    std::launder(static_cast<StoredType *>(Storage))->~StoredType();
+                                    break;
+                            }
+                        };
+                    }
+                } else {
+                    *reinterpret_cast<StoredType **>(Storage) = new StoredType(std::forward<FunctionType>(Function));
+                    Call = [](void *Storage, ArgumentTypes... Arguments) {
+                        std::invoke(**static_cast<StoredType **>(Storage), Arguments...);
+                    };
+                    Manage = [](const StorageOperation Operation, void *Storage, void *Source) {
+                        switch (Operation) {
+                            case StorageOperation::COPY:
+                                *static_cast<StoredType **>(Storage) = new StoredType(**static_cast<StoredType **>(Source));
+                                break;
+                            case StorageOperation::MOVE:
+                                *static_cast<StoredType **>(Storage) = *static_cast<StoredType **>(Source);
+                                *static_cast<StoredType **>(Source) = nullptr;
+                                break;
+                            case StorageOperation::DESTROY:
+                                delete *static_cast<StoredType **>(Storage);
+                                break;
+                        }
+                    };
+                }
+            }
+        };
+
+        /** Calls the given member function on the object stored in a bound function. */
+        template<auto Method, typename ObjectType>
+        static void CallMethod(void *Storage, ArgumentTypes... Arguments) {
+            ObjectType *Object;
+            std::memcpy(&Object, Storage, sizeof(Object));
+            std::invoke(Method, Object, Arguments...);
+        }
+
+        /** Each of the functions bound to a delegate and the state of its invocations. */
+        struct Bindings final {
+            /** Each bound function, in the order they were bound. */
+            std::vector<BoundFunction> Functions;
+
+            /** Each function bound while invoking, in the order they were bound. */
+            std::vector<BoundFunction> Pending;
+
+            /** The handle of the next bound function. */
+            DelegateHandle NextHandle = 1;
+
+            /** The number of bound functions that have not been unbound. */
+            int Bound = 0;
+
+            /** The number of invocations currently in progress. */
+            int Invoking = 0;
+
+            /** Whether a function was unbound while invoking. */
+            bool Unbound = false;
+
+            /** Removes unbound functions and adds pending functions once every invocation has finished. */
+            void Flush() {
+                if (Unbound) {
+                    Functions.erase(std::remove_if(Functions.begin(), Functions.end(),
+                                                   [](const BoundFunction &Function) {
+                                                       return Function.Call == nullptr;
+                                                   }), Functions.end());
+                    Pending.erase(std::remove_if(Pending.begin(), Pending.end(),
+                                                 [](const BoundFunction &Function) {
+                                                     return Function.Call == nullptr;
+                                                 }), Pending.end());
+                    Unbound = false;
+                }
+                if (!Pending.empty()) {
+                    std::move(Pending.begin(), Pending.end(), std::back_inserter(Functions));
+                    Pending.clear();
+                }
+            }
+
+            /** Returns the bound function with the given handle in the given functions, or nullptr. */
+            [[nodiscard]] static BoundFunction *Find(std::vector<BoundFunction> &Functions,
+                                                     const DelegateHandle &Handle) {
+                // Handles only increase so each list is sorted by handle
+                const auto Found = std::lower_bound(Functions.begin(), Functions.end(), Handle,
+                                                    [](const BoundFunction &Function, const DelegateHandle &Handle) {
+                                                        return Function.Handle < Handle;
+                                                    });
+                return Found != Functions.end() && Found->Handle == Handle && Found->Call != nullptr
+                           ? &*Found
+                           : nullptr;
+            }
+
+            /** Returns the bound function with the given handle, or nullptr. */
+            [[nodiscard]] BoundFunction *Find(const DelegateHandle &Handle) {
+                if (const auto Found = Find(Functions, Handle); Found != nullptr) {
+                    return Found;
+                }
+                return Find(Pending, Handle);
+            }
+
+            /** Unbinds the given bound function, which is only destroyed once no invocation could be calling it. */
+            void Remove(BoundFunction &Function) {
+                --Bound;
+                if (Invoking > 0) {
+                    Function.Call = nullptr;
+                    Unbound = true;
+                } else {
+                    Functions.erase(Functions.begin() + (&Function - Functions.data()));
+                }
+            }
+        };
+
+        /** The functions bound to this delegate, or nullptr if nothing has been bound yet. */
+        std::unique_ptr<Bindings> State;
+
+        /** Adds the given bound function to this delegate and returns its handle. */
+        DelegateHandle Add(BoundFunction &&Function) {
+            if (State == nullptr) {
+                State = std::make_unique<Bindings>();
+            }
+            const DelegateHandle Handle = State->NextHandle++;
+            Function.Handle = Handle;
+            ++State->Bound;
+            (State->Invoking > 0 ? State->Pending : State->Functions).push_back(std::move(Function));
+            return Handle;
+        }
 
     public:
+        // CONSTRUCTORS
+
+        /** Constructs a new empty delegate. */
+        Delegate() = default;
+
+        /** Copies each function bound to the given delegate. */
+        Delegate(const Delegate &Copied) {
+            if (Copied.State != nullptr) {
+                State = std::make_unique<Bindings>(*Copied.State);
+                State->Invoking = 0;
+                State->Flush();
+            }
+        }
+
+        /** Moves each function bound to the given delegate. */
+        Delegate(Delegate &&Moved) noexcept = default;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Copies each function bound to the given delegate. */
+        Delegate &operator=(const Delegate &Copied) {
+            if (this != &Copied) {
+                Delegate Copy(Copied);
+                State = std::move(Copy.State);
+            }
+            return *this;
+        }
+
+        /** Moves each function bound to the given delegate. */
+        Delegate &operator=(Delegate &&Moved) noexcept = default;
+
         // BIND
 
-        /** Binds the given function to this delegate. */
-        void Bind(const std::function<void(ArgumentTypes...)> &Function) {
-            if (Function != nullptr) {
-                Functions.push_back(Function);
-            } else {
-                throw std::runtime_error("ERROR: Attempted to bind an invalid function to the delegate!");
+        /**
+         * Binds the given function to this delegate.<br/>
+         * Returns a handle that unbinds the function when passed to Unbind().
+         */
+        template<typename FunctionType, typename = std::enable_if_t<
+            std::is_invocable_v<std::decay_t<FunctionType> &, ArgumentTypes...> > >
+        DelegateHandle Bind(FunctionType &&Function) {
+            if constexpr (std::is_constructible_v<bool, const std::decay_t<FunctionType> &>) {
+                if (!static_cast<bool>(Function)) {
+                    throw std::runtime_error("ERROR: Attempted to bind an invalid function to the delegate!");
+                }
             }
+            BoundFunction Bound;
+            Bound.Store(std::forward<FunctionType>(Function));
+            return Add(std::move(Bound));
+        }
+
+        /**
+         * Binds the given member function of the given object to this delegate without allocating or copying the object.<br/>
+         * The object must unbind the function with Unbind<Method>(Object) or its handle before it is destroyed.<br/>
+         * Returns a handle that unbinds the function when passed to Unbind().
+         */
+        template<auto Method, typename ObjectType>
+        DelegateHandle Bind(ObjectType *Object) {
+            if (Object == nullptr) {
+                throw std::runtime_error("ERROR: Attempted to bind a function of an invalid object to the delegate!");
+            }
+            BoundFunction Bound;
+            std::memcpy(Bound.Storage, &Object, sizeof(Object));
+            Bound.Call = &CallMethod<Method, ObjectType>;
+            return Add(std::move(Bound));
         }
 
         /** Binds the given function to this delegate. */
-        Delegate &operator+=(const std::function<void(ArgumentTypes...)> &Function) {
-            Bind(Function);
+        template<typename FunctionType>
+        Delegate &operator+=(FunctionType &&Function) {
+            Bind(std::forward<FunctionType>(Function));
             return *this;
         }
 
         // UNBIND
 
-        /** Unbinds the given function from this delegate. */
-        void Unbind(const std::function<void(ArgumentTypes...)> &Function) {
-            for (int i = 0; i < Functions.size(); i++) {
-                if (Functions[i].template target<void(ArgumentTypes...)>() ==
-                    Function.template target<void(ArgumentTypes...)>()) {
-                    Functions.erase(Functions.begin() + i);
-                    return;
+        /** Unbinds the function with the given handle from this delegate. */
+        void Unbind(const DelegateHandle &Handle) {
+            const auto Function = State != nullptr ? State->Find(Handle) : nullptr;
+            if (Function == nullptr) {
+                throw std::runtime_error("ERROR: Attempted to unbind a non-existent function from the delegate!");
+            }
+            State->Remove(*Function);
+        }
+
+        /** Unbinds the given member function of the given object from this delegate. */
+        template<auto Method, typename ObjectType>
+        void Unbind(ObjectType *Object) {
+            if (State != nullptr) {
+                for (auto &Functions: {&State->Functions, &State->Pending}) {
+                    for (auto &Function: *Functions) {
+                        if (Function.Call == &CallMethod<Method, ObjectType> &&
+                            std::memcmp(Function.Storage, &Object, sizeof(Object)) == 0) {
+                            State->Remove(Function);
+                            return;
+                        }
+                    }
                 }
             }
             throw std::runtime_error("ERROR: Attempted to unbind a non-existent function from the delegate!");
         }
 
-        /** Unbinds the given function from this delegate. */
-        Delegate &operator-=(const std::function<void(ArgumentTypes...)> &Function) {
-            Unbind(Function);
+        /** Unbinds the function with the given handle from this delegate. */
+        Delegate &operator-=(const DelegateHandle &Handle) {
+            Unbind(Handle);
             return *this;
         }
 
+        /** Returns whether the function with the given handle is bound to this delegate. */
+        [[nodiscard]] bool IsBound(const DelegateHandle &Handle) const {
+            return State != nullptr && State->Find(Handle) != nullptr;
+        }
+
         // INVOKE
 
         /** Invokes all of the functions for this delegate. */
         void Invoke(ArgumentTypes... Arguments) const {
-            for (const auto &Function: Functions) {
-                if (Function != nullptr) {
-                    Function(Arguments...);
-                } else {
-                    throw std::runtime_error("ERROR: Attempted to invoke an invalid function in the delegate!");
+            if (State == nullptr || State->Functions.empty()) {
+                return;
+            }
+
+            // Unbound and newly bound functions are only removed or added once every invocation finishes
+            struct InvokeScope final {
+                Bindings &State;
+
+                ~InvokeScope() {
+                    if (--State.Invoking == 0) {
+                        State.Flush();
+                    }
+                }
+            } Scope{*State};
+            ++State->Invoking;
+
+            const size_t Count = State->Functions.size();
+            for (size_t i = 0; i < Count; ++i) {
+                auto &Function = State->Functions[i];
+                if (Function.Call != nullptr) {
+                    Function.Call(Function.Storage, Arguments...);
                 }
             }
         }
@@ -78,16 +403,28 @@ namespace FureyEngine {
 
         /** Returns the number of bound functions to this delegate. */
         [[nodiscard]] int Count() const {
-            return static_cast<int>(Functions.size());
+            return State != nullptr ? State->Bound : 0;
         }
 
         // CLEAR
 
         /** Clears all functions bound to this delegate. */
         void Clear() {
-            if (!Functions.empty()) {
-                Functions.clear();
+            if (State == nullptr) {
+                return;
+            }
+            if (State->Invoking > 0) {
+                for (auto &Functions: {&State->Functions, &State->Pending}) {
+                    for (auto &Function: *Functions) {
+                        Function.Call = nullptr;
+                    }
+                }
+                State->Unbound = true;
+            } else {
+                State->Functions.clear();
+                State->Pending.clear();
             }
+            State->Bound = 0;
         }
     };
 }
@@ -15,17 +15,26 @@ namespace FureyEngine {
                 Worlds[UnloadedWorldName]->DestroyActor(Actor.get());
             }
 
-            Cleanup.Bind([&] {
-                if (Worlds[UnloadedWorldName] == nullptr) {
+            Cleanup.Bind([UnloadedWorldName] {
+                const auto Found = Worlds.find(UnloadedWorldName);
+                if (Found == Worlds.end() || Found->second == nullptr) {
                     return;
                 }
+                const auto &UnloadedWorld = Found->second;
+
+                // Destroy actors spawned since this world was queued to unload
+                UnloadedWorld->FlushCommands();
+                for (const auto &Actor: UnloadedWorld->Actors) {
+                    UnloadedWorld->DestroyActor(Actor.get());
+                }
+                UnloadedWorld->FlushCommands();
 
                 // Call unload events
-                Worlds[UnloadedWorldName]->Unload();
-                Worlds[UnloadedWorldName]->OnUnload(Worlds[UnloadedWorldName].get());
+                UnloadedWorld->Unload();
+                UnloadedWorld->OnUnload(UnloadedWorld.get());
 
                 // Call cleanup events
-                Worlds[UnloadedWorldName]->Cleanup();
+                UnloadedWorld->Cleanup();
 
                 // Delete this world
                 Worlds.erase(UnloadedWorldName);
@@ -40,6 +49,61 @@ namespace FureyEngine {
         return UnloadWorld(UnloadedWorld->Name);
     }
 
+    // Updates each loaded world once.
+    // Worlds that are not isolated are updated one after another on the calling thread first,
+    // then isolated worlds are updated in parallel across the world workers.
+    // This returns once every world has finished updating, so it is safe to render afterward.
+    void Engine::UpdateWorlds() {
+        PROFILE_ZONE("Engine::UpdateWorlds");
+
+        // Gather each world first since updating a world may load or unload others
+        static std::vector<std::shared_ptr<World> > SharedWorlds;
+        static std::vector<std::shared_ptr<World> > IsolatedWorlds;
+        struct GatherScope final {
+            ~GatherScope() {
+                // Release each world even if an update threw
+                SharedWorlds.clear();
+                IsolatedWorlds.clear();
+            }
+        } Scope;
+        for (const auto &[WorldName, World]: Worlds) {
+            (World->Isolated && WorldWorkers != nullptr ? IsolatedWorlds : SharedWorlds).push_back(World);
+        }
+
+        // Update worlds that share engine state on this thread
+        for (const auto &World: SharedWorlds) {
+            World->Update();
+        }
+
+        // Update isolated worlds across the world workers and wait for each of them
+        if (!IsolatedWorlds.empty()) {
+            WorldWorkers->ParallelFor(static_cast<int>(IsolatedWorlds.size()), [](const int Index) {
+                IsolatedWorlds[Index]->Update();
+            });
+        }
+    }
+
+    // TICK RATE
+
+    // Sleeps until the next engine loop should start according to the maximum tick rate.
+    // If a loop ran longer than a whole tick, the next loop starts immediately instead of bursting to catch up.
+    void Engine::WaitForNextTick() {
+        if (MaxTickRate <= 0) {
+            NextTickPoint = {};
+            return;
+        }
+
+        const auto TickDuration = std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+            std::chrono::duration<double>(1 / MaxTickRate));
+        const auto Now = std::chrono::high_resolution_clock::now();
+        if (NextTickPoint + TickDuration < Now) {
+            NextTickPoint = Now;
+        } else {
+            std::this_thread::sleep_until(NextTickPoint);
+        }
+        NextTickPoint += TickDuration;
+    }
+
     // CLOSING
 
     // Cleans up all resources before the engine closes.
@@ -102,6 +166,17 @@ namespace FureyEngine {
     // Each world able to run custom scripting logic through its actors.
     std::map<std::string, std::shared_ptr<World> > Engine::Worlds;
 
+    // The worker threads used to update isolated worlds in parallel.
+    // Set this to nullptr to update every world serially on the main thread.
+    std::shared_ptr<ThreadPool> Engine::WorldWorkers = nullptr;
+
+    // The maximum number of engine loops per second, or 0 to loop as fast as possible.
+    // Headless builds use this to simulate at a fixed real time rate, or leave it at 0 to measure throughput.
+    double Engine::MaxTickRate = 0;
+
+    // When the next engine loop should start while the tick rate is limited.
+    std::chrono::high_resolution_clock::time_point Engine::NextTickPoint;
+
     // Events to call at the very end of an engine loop.
     // This event is cleared after each loop.
     Event Engine::Cleanup;
@@ -22,6 +22,11 @@ namespace FureyEngine {
         /** Prevents instantiation of this class. */
         virtual void Abstract() = 0;
 
+        // TICK RATE
+
+        /** When the next engine loop should start while the tick rate is limited. */
+        static std::chrono::high_resolution_clock::time_point NextTickPoint;
+
     public:
         // RESOURCES
 
@@ -93,6 +98,12 @@ namespace FureyEngine {
         /** Each loaded world by name, with each able to run custom scripting logic through its actors. */
         static std::map<std::string, std::shared_ptr<World> > Worlds;
 
+        /**
+         * The worker threads used to update isolated worlds in parallel.<br/>
+         * Set this to nullptr to update every world serially on the main thread.
+         */
+        static std::shared_ptr<ThreadPool> WorldWorkers;
+
         // CLEANUP
 
         /**
@@ -115,6 +126,28 @@ namespace FureyEngine {
         /** Unloads the given world and returns if the given world was found. */
         static bool UnloadWorld(const Reference<World> &UnloadedWorld);
 
+        /**
+         * Updates each loaded world once.<br/>
+         * Worlds that are not isolated are updated one after another on the calling thread first,<br/>
+         * then isolated worlds are updated in parallel across the world workers.<br/>
+         * This returns once every world has finished updating, so it is safe to render afterward.
+         */
+        static void UpdateWorlds();
+
+        // TICK RATE
+
+        /**
+         * The maximum number of engine loops per second, or 0 to loop as fast as possible.<br/>
+         * Headless builds use this to simulate at a fixed real time rate, or leave it at 0 to measure throughput.
+         */
+        static double MaxTickRate;
+
+        /**
+         * Sleeps until the next engine loop should start according to the maximum tick rate.<br/>
+         * If a loop ran longer than a whole tick, the next loop starts immediately instead of bursting to catch up.
+         */
+        static void WaitForNextTick();
+
         // CLOSING
 
         /** Cleans up all resources before the engine closes. */
@@ -4,34 +4,65 @@
 
 #pragma once
 #include "../Standard/Standard.h"
+#include "../Delegate/Delegate.h"
 
 namespace FureyEngine {
     /**
      * A collection of void returning functions that can be bound<br/>
-     * and called simultaneously.
+     * and called simultaneously.<br/>
+     * Bound functions small enough are stored inline without allocating, and each binding returns a handle to unbind it.
      */
     class Event {
         // FUNCTIONS
 
         /** Each of the functions bound to this event. */
-        std::vector<std::function<void()> > Functions;
+        Delegate<> Functions;
 
     public:
         // BIND
 
-        /** Binds the given function to this event. */
-        void Bind(const std::function<void()> &Function);
+        /**
+         * Binds the given function to this event.<br/>
+         * Returns a handle that unbinds the function when passed to Unbind().
+         */
+        template<typename FunctionType>
+        DelegateHandle Bind(FunctionType &&Function) {
+            return Functions.Bind(std::forward<FunctionType>(Function));
+        }
+
+        /**
+         * Binds the given member function of the given object to this event without allocating or copying the object.<br/>
+         * The object must unbind the function with Unbind<Method>(Object) or its handle before it is destroyed.<br/>
+         * Returns a handle that unbinds the function when passed to Unbind().
+         */
+        template<auto Method, typename ObjectType>
+        DelegateHandle Bind(ObjectType *Object) {
+            return Functions.template Bind<Method>(Object);
+        }
 
         /** Binds the given function to this event. */
-        Event &operator+=(const std::function<void()> &Function);
+        template<typename FunctionType>
+        Event &operator+=(FunctionType &&Function) {
+            Bind(std::forward<FunctionType>(Function));
+            return *this;
+        }
 
         // UNBIND
 
-        /** Unbinds the given function from this event. */
-        void Unbind(const std::function<void()> &Function);
+        /** Unbinds the function with the given handle from this event. */
+        void Unbind(const DelegateHandle &Handle);
+
+        /** Unbinds the given member function of the given object from this event. */
+        template<auto Method, typename ObjectType>
+        void Unbind(ObjectType *Object) {
+            Functions.template Unbind<Method>(Object);
+        }
+
+        /** Unbinds the function with the given handle from this event. */
+        Event &operator-=(const DelegateHandle &Handle);
 
-        /** Unbinds the given function from this event. */
-        Event &operator-=(const std::function<void()> &Function);
+        /** Returns whether the function with the given handle is bound to this event. */
+        [[nodiscard]] bool IsBound(const DelegateHandle &Handle) const;
 
         // INVOKE
 
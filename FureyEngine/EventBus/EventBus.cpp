@@ -0,0 +1,78 @@
+// .cpp
+// Typed Event Bus Script
+// by Kyle Furey
+
+#include "EventBus.h"
+
+namespace FureyEngine {
+    // FILTER
+
+    // Returns whether an event published by the given actor on the given layer is received.
+    bool EventFilter::Matches(Actor *Sender, const ReferenceHandle &SenderHandle, const std::string &Layer) const {
+        if (this->Sender.Generation != 0 &&
+            (this->Sender.Index != SenderHandle.Index || this->Sender.Generation != SenderHandle.Generation)) {
+            return false;
+        }
+        if (!Tag.empty() && (Sender == nullptr || Sender->Tag != Tag)) {
+            return false;
+        }
+        return this->Layer.empty() || this->Layer == Layer || this->Layer == "All" || Layer == "All";
+    }
+
+    // QUEUES
+
+    // Returns a new unique index for an event type.
+    size_t EventBus::NewTypeIndex() {
+        static std::atomic<size_t> NextIndex = 0;
+        return NextIndex++;
+    }
+
+    // DISPATCH
+
+    // Calls each subscriber with each queued event of each type, then clears them.
+    // Worlds automatically call this after actors tick and after actors late tick.
+    void EventBus::Dispatch() {
+        PROFILE_ZONE("EventBus::Dispatch");
+
+        // Queues are looked up by index since subscribers may publish events of a new type
+        for (size_t i = 0;; ++i) {
+            EventQueue *Queue;
+            {
+                std::lock_guard Lock(Mutex);
+                if (i >= Queues.size()) {
+                    return;
+                }
+                Queue = Queues[i].get();
+            }
+            if (Queue != nullptr) {
+                Queue->Dispatch(Mutex);
+            }
+        }
+    }
+
+    // COUNT
+
+    // Returns the number of queued events of every type.
+    int EventBus::Count() const {
+        std::lock_guard Lock(Mutex);
+        int Total = 0;
+        for (const auto &Queue: Queues) {
+            if (Queue != nullptr) {
+                Total += Queue->Count();
+            }
+        }
+        return Total;
+    }
+
+    // CLEAR
+
+    // Removes each queued event without dispatching it.
+    void EventBus::Clear() {
+        std::lock_guard Lock(Mutex);
+        for (const auto &Queue: Queues) {
+            if (Queue != nullptr) {
+                Queue->Clear();
+            }
+        }
+    }
+}
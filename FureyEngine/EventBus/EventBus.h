@@ -0,0 +1,289 @@
+// .h
+// Typed Event Bus Script
+// by Kyle Furey
+
+#pragma once
+#include "../Actors/Actor.h"
+#include "../Profiler/Profiler.h"
+
+namespace FureyEngine {
+    /** Chooses which published events a subscriber receives, where each empty field matches every event. */
+    struct EventFilter final {
+        /** The handle of the only actor whose events are received, or a null handle for any actor. */
+        ReferenceHandle Sender;
+
+        /** The tag of the only actors whose events are received, or empty for any tag. */
+        std::string Tag;
+
+        /** The only layer whose events are received, or empty for any layer. */
+        std::string Layer;
+
+        /** Returns whether an event published by the given actor on the given layer is received. */
+        [[nodiscard]] bool Matches(Actor *Sender, const ReferenceHandle &SenderHandle, const std::string &Layer) const;
+    };
+
+    /**
+     * A world's queue of typed events used to message between actors without calling them directly.<br/>
+     * Published events are appended to a contiguous queue for their type and are not received immediately.<br/>
+     * Instead, each queue is dispatched to its subscribers in one batch at defined points of each world update,<br/>
+     * so handlers are free to spawn, destroy, subscribe or publish without disturbing the iteration that published them.<br/>
+     * Events published while dispatching are received at the next dispatch.<br/>
+     * NOTE: Events may be published from any thread, but subscribing and dispatching must happen on the world's thread.
+     */
+    class EventBus final {
+        // QUEUES
+
+        /** A queue of events of one type. */
+        struct EventQueue {
+            /** Destroys this queue. */
+            virtual ~EventQueue() = default;
+
+            /** Calls each subscriber with each queued event, then clears them. */
+            virtual void Dispatch(std::mutex &Mutex) = 0;
+
+            /** Returns the number of queued events. */
+            [[nodiscard]] virtual int Count() const = 0;
+
+            /** Removes each queued event without dispatching it. */
+            virtual void Clear() = 0;
+        };
+
+        /** A queue of events of the given type. */
+        template<typename EventType>
+        struct TypedEventQueue final : EventQueue {
+            /** A published event and where it was published from. */
+            struct PublishedEvent final {
+                /** The published event. */
+                EventType Event;
+
+                /** The actor that published the event, or nullptr. */
+                Actor *Sender = nullptr;
+
+                /** The handle of the actor that published the event. */
+                ReferenceHandle SenderHandle;
+
+                /** The layer the event was published on. */
+                std::string Layer;
+            };
+
+            /** Each event published since the last dispatch, in the order they were published. */
+            std::vector<PublishedEvent> Events;
+
+            /** Each event being dispatched, kept between dispatches to reuse its memory. */
+            std::vector<PublishedEvent> DispatchingEvents;
+
+            /** Each subscriber, which filters and receives each dispatched event. */
+            Delegate<const PublishedEvent &> Subscribers;
+
+            /** Whether these events are being dispatched. */
+            bool Dispatching = false;
+
+            /** Calls each subscriber with each queued event, then clears them. */
+            void Dispatch(std::mutex &Mutex) override {
+                if (Dispatching) {
+                    return;
+                }
+                {
+                    std::lock_guard Lock(Mutex);
+                    if (Events.empty()) {
+                        return;
+                    }
+                    std::swap(Events, DispatchingEvents);
+                }
+
+                // Events published by subscribers are queued for the next dispatch
+                Dispatching = true;
+                struct DispatchScope final {
+                    TypedEventQueue &Queue;
+
+                    ~DispatchScope() {
+                        Queue.DispatchingEvents.clear();
+                        Queue.Dispatching = false;
+                    }
+                } Scope{*this};
+                for (const auto &Event: DispatchingEvents) {
+                    Subscribers(Event);
+                }
+            }
+
+            /** Returns the number of queued events. */
+            [[nodiscard]] int Count() const override {
+                return static_cast<int>(Events.size());
+            }
+
+            /** Removes each queued event without dispatching it. */
+            void Clear() override {
+                Events.clear();
+            }
+        };
+
+        /** Each event type's queue, indexed by event type. */
+        std::vector<std::unique_ptr<EventQueue> > Queues;
+
+        /** Guards publishing events, since events may be published by components ticking on worker threads. */
+        mutable std::mutex Mutex;
+
+        /** Returns a new unique index for an event type. */
+        [[nodiscard]] static size_t NewTypeIndex();
+
+        /** Returns the unique index of the given event type. */
+        template<typename EventType>
+        [[nodiscard]] static size_t TypeIndex() {
+            static const size_t Index = NewTypeIndex();
+            return Index;
+        }
+
+        /** Returns the queue of the given event type, creating it if needed, while the mutex is locked. */
+        template<typename EventType>
+        [[nodiscard]] TypedEventQueue<EventType> &Queue() {
+            const size_t Index = TypeIndex<EventType>();
+            if (Index >= Queues.size()) {
+                Queues.resize(Index + 1);
+            }
+            if (Queues[Index] == nullptr) {
+                Queues[Index] = std::make_unique<TypedEventQueue<EventType> >();
+            }
+            return static_cast<TypedEventQueue<EventType> &>(*Queues[Index]);
+        }
+
+        /** Returns the queue of the given event type, or nullptr if none has been created, while the mutex is locked. */
+        template<typename EventType>
+        [[nodiscard]] TypedEventQueue<EventType> *FindQueue() const {
+            const size_t Index = TypeIndex<EventType>();
+            return Index < Queues.size() ? static_cast<TypedEventQueue<EventType> *>(Queues[Index].get()) : nullptr;
+        }
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new empty event bus. */
+        EventBus() = default;
+
+        /** Delete copy constructor. */
+        EventBus(const EventBus &Copied) = delete;
+
+        /** Delete move constructor. */
+        EventBus(EventBus &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        EventBus &operator=(const EventBus &Copied) = delete;
+
+        /** Delete move constructor. */
+        EventBus &operator=(EventBus &&Moved) = delete;
+
+        // PUBLISH
+
+        /**
+         * Queues the given event to be received by each subscriber to its type at the next dispatch.<br/>
+         * The sender and layer are used to filter which subscribers receive the event.
+         */
+        template<typename EventType>
+        void Publish(EventType &&Event, const Reference<Actor> &Sender = nullref, const std::string &Layer = "All") {
+            using QueuedType = std::decay_t<EventType>;
+            Actor *const SenderActor = Sender.Get();
+            const ReferenceHandle SenderHandle = SenderActor != nullptr ? SenderActor->GetHandle() : ReferenceHandle();
+            std::lock_guard Lock(Mutex);
+            Queue<QueuedType>().Events.push_back({std::forward<EventType>(Event), SenderActor, SenderHandle, Layer});
+        }
+
+        // SUBSCRIBE
+
+        /**
+         * Calls the given function with each dispatched event of the given type that passes the given filter.<br/>
+         * The function takes a const reference to the event and the actor that published it,<br/>
+         * which is nullptr if it was published without an actor or has since been destroyed.<br/>
+         * Returns a handle that unsubscribes the function when passed to Unsubscribe().
+         */
+        template<typename EventType, typename FunctionType>
+        DelegateHandle Subscribe(FunctionType &&Function, EventFilter Filter = {}) {
+            using PublishedEvent = typename TypedEventQueue<EventType>::PublishedEvent;
+            TypedEventQueue<EventType> *EventQueue;
+            {
+                std::lock_guard Lock(Mutex);
+                EventQueue = &Queue<EventType>();
+            }
+
+            // Unfiltered subscribers skip checking each event
+            if (Filter.Sender.Generation == 0 && Filter.Tag.empty() && Filter.Layer.empty()) {
+                return EventQueue->Subscribers.Bind(
+                    [Function = std::forward<FunctionType>(Function)](const PublishedEvent &Event) mutable {
+                        Function(Event.Event, ReferenceRegistry::IsValid(Event.SenderHandle) ? Event.Sender : nullptr);
+                    });
+            }
+            return EventQueue->Subscribers.Bind(
+                [Function = std::forward<FunctionType>(Function), Filter = std::move(Filter)]
+            (const PublishedEvent &Event) mutable {
+                    Actor *Sender = ReferenceRegistry::IsValid(Event.SenderHandle) ? Event.Sender : nullptr;
+                    if (Filter.Matches(Sender, Event.SenderHandle, Event.Layer)) {
+                        Function(Event.Event, Sender);
+                    }
+                });
+        }
+
+        /** Stops calling the subscribed function with the given handle for events of the given type. */
+        template<typename EventType>
+        void Unsubscribe(const DelegateHandle &Handle) {
+            TypedEventQueue<EventType> *EventQueue;
+            {
+                std::lock_guard Lock(Mutex);
+                EventQueue = FindQueue<EventType>();
+            }
+            if (EventQueue == nullptr) {
+                throw std::runtime_error("ERROR: Attempted to unsubscribe a non-existent function from the event bus!");
+            }
+            EventQueue->Subscribers.Unbind(Handle);
+        }
+
+        /** Returns the number of functions subscribed to events of the given type. */
+        template<typename EventType>
+        [[nodiscard]] int CountSubscribers() const {
+            std::lock_guard Lock(Mutex);
+            const auto EventQueue = FindQueue<EventType>();
+            return EventQueue != nullptr ? EventQueue->Subscribers.Count() : 0;
+        }
+
+        // DISPATCH
+
+        /**
+         * Calls each subscriber with each queued event of the given type, then clears them.<br/>
+         * Worlds automatically dispatch every event type after actors tick and after actors late tick.
+         */
+        template<typename EventType>
+        void Dispatch() {
+            TypedEventQueue<EventType> *EventQueue;
+            {
+                std::lock_guard Lock(Mutex);
+                EventQueue = FindQueue<EventType>();
+            }
+            if (EventQueue != nullptr) {
+                EventQueue->Dispatch(Mutex);
+            }
+        }
+
+        /**
+         * Calls each subscriber with each queued event of each type, then clears them.<br/>
+         * Worlds automatically call this after actors tick and after actors late tick.
+         */
+        void Dispatch();
+
+        // COUNT
+
+        /** Returns the number of queued events of the given type. */
+        template<typename EventType>
+        [[nodiscard]] int Count() const {
+            std::lock_guard Lock(Mutex);
+            const auto EventQueue = FindQueue<EventType>();
+            return EventQueue != nullptr ? EventQueue->Count() : 0;
+        }
+
+        /** Returns the number of queued events of every type. */
+        [[nodiscard]] int Count() const;
+
+        // CLEAR
+
+        /** Removes each queued event without dispatching it. */
+        void Clear();
+    };
+}
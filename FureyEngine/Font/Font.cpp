@@ -32,6 +32,15 @@ namespace FureyEngine {
                                      std::string(TTF_GetError()));
         }
 
+#if HEADLESS
+        // Only measure the text since there is no OpenGL context to store its texture in
+        if (TTF_SizeText(MyFont, FontText.empty() ? " " : FontText.c_str(), &MyTextureSize.x, &MyTextureSize.y) != 0) {
+            TTF_CloseFont(MyFont);
+            TTF_Quit();
+            throw std::runtime_error("ERROR: TTF failed to load a font file!\nTTF Error: " +
+                                     std::string(TTF_GetError()));
+        }
+#else
         // Create a temporary surface with the given font file
         SDL_Surface *Surface;
 #if BLENDED_TEXT
@@ -78,6 +87,7 @@ namespace FureyEngine {
 
         // Unbind the texture
         glBindTexture(GL_TEXTURE_2D, 0);
+#endif
     }
 
     // DESTRUCTOR
@@ -226,6 +236,15 @@ namespace FureyEngine {
 
         FontText = Text;
 
+#if HEADLESS
+        // Only measure the text since there is no OpenGL context to store its texture in
+        if (TTF_SizeText(MyFont, FontText.empty() ? " " : FontText.c_str(), &MyTextureSize.x, &MyTextureSize.y) != 0) {
+            TTF_CloseFont(MyFont);
+            TTF_Quit();
+            throw std::runtime_error("ERROR: TTF failed to reload a font file!\nTTF Error: " +
+                                     std::string(TTF_GetError()));
+        }
+#else
         // Create a temporary surface with the given font file
         SDL_Surface *Surface;
 #if BLENDED_TEXT
@@ -272,6 +291,7 @@ namespace FureyEngine {
 
         // Unbind the texture
         glBindTexture(GL_TEXTURE_2D, 0);
+#endif
 
         return MyTextureID;
     }
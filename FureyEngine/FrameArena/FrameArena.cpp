@@ -0,0 +1,120 @@
+// .cpp
+// Frame Arena Allocator Script
+// by Kyle Furey
+
+#include "FrameArena.h"
+
+namespace FureyEngine {
+    // BLOCKS
+
+    // Allocates a new block that can hold at least the given number of bytes and allocates from it.
+    void FrameArena::AddBlock(const size_t &MinimumSize) {
+        const size_t Size = std::max(BlockSize, MinimumSize);
+        Blocks.push_back({std::make_unique<unsigned char[]>(Size), Size});
+        Offset = 0;
+    }
+
+    // CONSTRUCTORS
+
+    // Constructs a new empty arena that allocates blocks of the given size.
+    FrameArena::FrameArena(const size_t &BlockSize)
+        : BlockSize(BlockSize > 0 ? BlockSize : FRAME_ARENA_BLOCK_SIZE) {
+    }
+
+    // ALLOCATION
+
+    // Returns the given number of bytes aligned to the given alignment, which are valid until this arena is reset.
+    void *FrameArena::Allocate(const size_t &Size, const size_t &Alignment) {
+        // Align the next allocation within the current block
+        size_t Start = 0;
+        if (!Blocks.empty()) {
+            const auto Address = reinterpret_cast<uintptr_t>(Blocks.back().Memory.get()) + Offset;
+            Start = Offset + ((Alignment - Address % Alignment) % Alignment);
+        }
+
+        // Move to a new block if it does not fit
+        if (Blocks.empty() || Start + Size > Blocks.back().Size) {
+            AddBlock(Size + Alignment);
+            const auto Address = reinterpret_cast<uintptr_t>(Blocks.back().Memory.get());
+            Start = (Alignment - Address % Alignment) % Alignment;
+        }
+
+        UsedBytes += Start - Offset + Size;
+        PeakBytes = std::max(PeakBytes, UsedBytes);
+        Offset = Start + Size;
+        return Blocks.back().Memory.get() + Start;
+    }
+
+    // Frees everything allocated by this arena at once.
+    // If this arena needed more than one block, they are merged into a single block
+    // so the same amount of memory fits without allocating next frame.
+    void FrameArena::Reset() {
+        if (Blocks.size() > 1) {
+            const size_t Size = Capacity();
+            Blocks.clear();
+            AddBlock(Size);
+        }
+        Offset = 0;
+        UsedBytes = 0;
+    }
+
+    // SIZE
+
+    // Returns the number of bytes allocated since this arena was last reset.
+    size_t FrameArena::Used() const {
+        return UsedBytes;
+    }
+
+    // Returns the most bytes this arena has had allocated at once.
+    size_t FrameArena::Peak() const {
+        return PeakBytes;
+    }
+
+    // Returns the total size in bytes of each block owned by this arena.
+    size_t FrameArena::Capacity() const {
+        size_t Size = 0;
+        for (const auto &Block: Blocks) {
+            Size += Block.Size;
+        }
+        return Size;
+    }
+
+    // THREAD ARENAS
+
+    // Returns the current thread's arena.
+    FrameArena &FrameArena::Current() {
+        // Each thread registers its arena the first time it is used
+        thread_local struct ThreadArena final {
+            FrameArena Arena;
+
+            ThreadArena() {
+                std::lock_guard Lock(ThreadArenasMutex);
+                ThreadArenas.push_back(&Arena);
+            }
+
+            ~ThreadArena() {
+                std::lock_guard Lock(ThreadArenasMutex);
+                ThreadArenas.erase(std::find(ThreadArenas.begin(), ThreadArenas.end(), &Arena));
+            }
+        } Thread;
+        return Thread.Arena;
+    }
+
+    // Resets each thread's arena.
+    // This is automatically called at the end of each engine loop.
+    // NOTE: This must only be called while no other thread is allocating from its arena.
+    void FrameArena::ResetAll() {
+        std::lock_guard Lock(ThreadArenasMutex);
+        for (const auto Arena: ThreadArenas) {
+            Arena->Reset();
+        }
+    }
+
+    // STATIC VARIABLE INITIALIZATION
+
+    // Guards each thread's arena.
+    std::mutex FrameArena::ThreadArenasMutex;
+
+    // Each thread's arena.
+    std::vector<FrameArena *> FrameArena::ThreadArenas;
+}
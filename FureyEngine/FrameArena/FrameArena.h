@@ -0,0 +1,207 @@
+// .h
+// Frame Arena Allocator Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+
+// The default size in bytes of each block of memory allocated by a frame arena.
+#define FRAME_ARENA_BLOCK_SIZE 65536
+
+namespace FureyEngine {
+    /**
+     * A linear allocator for memory that only needs to live until the end of the current frame.<br/>
+     * Allocations bump a pointer through a block of memory and are never freed individually.<br/>
+     * Instead, the whole arena is reset once each frame so its memory is reused without touching the heap.<br/>
+     * Each thread has its own arena returned by FrameArena::Current().
+     */
+    class FrameArena final {
+        // BLOCKS
+
+        /** A block of memory owned by an arena. */
+        struct Block final {
+            /** This block's memory. */
+            std::unique_ptr<unsigned char[]> Memory;
+
+            /** The size of this block in bytes. */
+            size_t Size = 0;
+        };
+
+        /** Each block of memory owned by this arena, with the block currently being allocated from last. */
+        std::vector<Block> Blocks;
+
+        /** The offset of the next allocation within the current block. */
+        size_t Offset = 0;
+
+        /** The size in bytes of each new block. */
+        size_t BlockSize;
+
+        /** The number of bytes allocated since this arena was last reset. */
+        size_t UsedBytes = 0;
+
+        /** The most bytes this arena has had allocated at once. */
+        size_t PeakBytes = 0;
+
+        /** Allocates a new block that can hold at least the given number of bytes and allocates from it. */
+        void AddBlock(const size_t &MinimumSize);
+
+        // THREAD ARENAS
+
+        /** Guards each thread's arena. */
+        static std::mutex ThreadArenasMutex;
+
+        /** Each thread's arena. */
+        static std::vector<FrameArena *> ThreadArenas;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new empty arena that allocates blocks of the given size. */
+        explicit FrameArena(const size_t &BlockSize = FRAME_ARENA_BLOCK_SIZE);
+
+        /** Delete copy constructor. */
+        FrameArena(const FrameArena &Copied) = delete;
+
+        /** Delete move constructor. */
+        FrameArena(FrameArena &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        FrameArena &operator=(const FrameArena &Copied) = delete;
+
+        /** Delete move constructor. */
+        FrameArena &operator=(FrameArena &&Moved) = delete;
+
+        // ALLOCATION
+
+        /** Returns the given number of bytes aligned to the given alignment, which are valid until this arena is reset. */
+        [[nodiscard]] void *Allocate(const size_t &Size, const size_t &Alignment = alignof(std::max_align_t));
+
+        /**
+         * Constructs a new object of the given type in this arena.<br/>
+         * Destructors are never called, so only trivially destructible types can be constructed.
+         */
+        template<typename Type, typename... ArgumentTypes>
+        [[nodiscard]] Type *New(ArgumentTypes &&... Arguments) {
+            static_assert(std::is_trivially_destructible_v<Type>,
+                          "Only trivially destructible types can be constructed in a frame arena!");
+            return new(Allocate(sizeof(Type), alignof(Type))) Type(std::forward<ArgumentTypes>(Arguments)...);
+        }
+
+        /**
+         * Returns an uninitialized array of the given number of objects of the given type in this arena.<br/>
+         * Destructors are never called, so only trivially destructible types can be allocated.
+         */
+        template<typename Type>
+        [[nodiscard]] Type *NewArray(const size_t &Count) {
+            static_assert(std::is_trivially_destructible_v<Type>,
+                          "Only trivially destructible types can be allocated in a frame arena!");
+            return static_cast<Type *>(Allocate(sizeof(Type) * Count, alignof(Type)));
+        }
+
+        /**
+         * Frees everything allocated by this arena at once.<br/>
+         * If this arena needed more than one block, they are merged into a single block<br/>
+         * so the same amount of memory fits without allocating next frame.
+         */
+        void Reset();
+
+        // SIZE
+
+        /** Returns the number of bytes allocated since this arena was last reset. */
+        [[nodiscard]] size_t Used() const;
+
+        /** Returns the most bytes this arena has had allocated at once. */
+        [[nodiscard]] size_t Peak() const;
+
+        /** Returns the total size in bytes of each block owned by this arena. */
+        [[nodiscard]] size_t Capacity() const;
+
+        // THREAD ARENAS
+
+        /** Returns the current thread's arena. */
+        [[nodiscard]] static FrameArena &Current();
+
+        /**
+         * Resets each thread's arena.<br/>
+         * This is automatically called at the end of each engine loop.<br/>
+         * NOTE: This must only be called while no other thread is allocating from its arena.
+         */
+        static void ResetAll();
+    };
+
+    /**
+     * An STL allocator that allocates from a frame arena.<br/>
+     * Containers using this allocator must not outlive the end of the frame.
+     */
+    template<typename Type>
+    class FrameAllocator {
+        // ARENA
+
+        /** The arena this allocator allocates from. */
+        FrameArena *Arena;
+
+    public:
+        /** The type of object this allocator allocates. */
+        using value_type = Type;
+
+        // CONSTRUCTORS
+
+        /** Constructs a new allocator for the current thread's arena. */
+        FrameAllocator() : Arena(&FrameArena::Current()) {
+        }
+
+        /** Constructs a new allocator for the given arena. */
+        explicit FrameAllocator(FrameArena &Arena) : Arena(&Arena) {
+        }
+
+        /** Constructs a new allocator for the same arena as the given allocator. */
+        template<typename OtherType>
+        FrameAllocator(const FrameAllocator<OtherType> &Other) : Arena(Other.GetArena()) {
+        }
+
+        // ALLOCATION
+
+        /** Returns memory for the given number of objects. */
+        [[nodiscard]] Type *allocate(const size_t Count) {
+            return static_cast<Type *>(Arena->Allocate(sizeof(Type) * Count, alignof(Type)));
+        }
+
+        /** Does nothing, since frame arena memory is freed when the arena is reset. */
+        void deallocate(Type *, const size_t) {
+        }
+
+        // ARENA
+
+        /** Returns the arena this allocator allocates from. */
+        [[nodiscard]] FrameArena *GetArena() const {
+            return Arena;
+        }
+
+        // EQUALITY
+
+        /** Returns whether the given allocators allocate from the same arena. */
+        template<typename OtherType>
+        [[nodiscard]] bool operator ==(const FrameAllocator<OtherType> &Other) const {
+            return Arena == Other.GetArena();
+        }
+
+        /** Returns whether the given allocators allocate from different arenas. */
+        template<typename OtherType>
+        [[nodiscard]] bool operator !=(const FrameAllocator<OtherType> &Other) const {
+            return Arena != Other.GetArena();
+        }
+    };
+
+    /** A vector allocated from a frame arena that must not outlive the end of the frame. */
+    template<typename Type>
+    using FrameVector = std::vector<Type, FrameAllocator<Type> >;
+
+    /** A map allocated from a frame arena that must not outlive the end of the frame. */
+    template<typename KeyType, typename ValueType>
+    using FrameMap = std::map<KeyType, ValueType, std::less<KeyType>, FrameAllocator<std::pair<const KeyType, ValueType> > >;
+
+    /** A string allocated from a frame arena that must not outlive the end of the frame. */
+    using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char> >;
+}
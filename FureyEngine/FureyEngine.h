@@ -17,6 +17,9 @@
 #include "Quad/Quad.h"
 #include "Transform/Transform.h"
 #include "Math/Math.h"
+#include "Random/Random.h"
+#include "FrameArena/FrameArena.h"
+#include "PoolAllocator/PoolAllocator.h"
 #include "Texture/Texture.h"
 #include "Renderer/Renderer.h"
 #include "Image/Image.h"
@@ -27,14 +30,29 @@
 #include "Input/Input.h"
 #include "Controller/Controller.h"
 #include "Thread/Thread.h"
+#include "ThreadPool/ThreadPool.h"
+#include "TimerWheel/TimerWheel.h"
+#include "Coroutine/Coroutine.h"
+#include "AllocationTracker/AllocationTracker.h"
+#include "Profiler/Profiler.h"
 #include "PointerArray/PointerArray.h"
 #include "Animation/Animation.h"
 #include "Reference/Reference.h"
+#include "TickPhase/TickPhase.h"
+#include "TickAccess/TickAccess.h"
+#include "TickRate/TickRate.h"
+#include "Snapshot/Snapshot.h"
 #include "Components/Component.h"
+#include "ComponentTable/ComponentTable.h"
 #include "Actors/Actor.h"
+#include "ActorPool/ActorPool.h"
+#include "CommandBuffer/CommandBuffer.h"
+#include "EventBus/EventBus.h"
 #include "Worlds/World.h"
+#include "WorldPartition/WorldPartition.h"
 #include "Resource/Resource.h"
 #include "Engine/Engine.h"
+#include "PerformanceHUD/PerformanceHUD.h"
 #include "Components/RenderComponent/RenderComponent.h"
 #include "Components/TextComponent/TextComponent.h"
 #include "Components/AnimationComponent/AnimationComponent.h"
@@ -44,6 +62,7 @@
 #include "Components/MovementComponent/MovementComponent.h"
 #include "Components/PhysicsComponent/PhysicsComponent.h"
 #include "Components/StateMachineComponent/StateMachineComponent.h"
+#include "Components/StreamingComponent/StreamingComponent.h"
 #include "Actors/PawnActor/PawnActor.h"
 #include "Actors/SpriteActor/SpriteActor.h"
 #include "Actors/TextActor/TextActor.h"
@@ -68,6 +87,13 @@ int main(int argc, char **argv) {
 #if DEBUG
     try {
 #endif
+#if HEADLESS
+        // Initialize SDL without video since headless builds have no window, OpenGL context or renderer
+        if (SDL_Init(SDL_INIT_EVENTS | SDL_INIT_TIMER) != 0) {
+            throw std::runtime_error("ERROR: SDL failed to initialize!\nSDL Error: " +
+                                     std::string(SDL_GetError()));
+        }
+#else
         // Create a new window
         FureyEngine::Resources::Windows("main",
                                         PROJECT_NAME "  -  " PROJECT_CREATOR,
@@ -83,10 +109,57 @@ int main(int argc, char **argv) {
         FureyEngine::Resources::Renderers("main",
                                           &FureyEngine::Resources::Shaders["main"],
                                           &FureyEngine::Resources::Windows["main"]);
+#endif
 
         // Bind quit events
         FureyEngine::Input::KeyboardEvents[SDLK_ESCAPE].Bind([&](auto) { FureyEngine::Input::Quit(); });
 
+#if !HEADLESS
+        // Bind the performance overlay's toggle
+        FureyEngine::Input::KeyboardEvents[SDLK_F3].Bind([&](const FureyEngine::ButtonState &State) {
+            if (State == FureyEngine::ButtonState::DOWN) {
+                FureyEngine::PerformanceHUD::Toggle();
+            }
+        });
+#endif
+
+#if PROFILING
+        // Record profiled zones from the start, which can be exported with Profiler::ExportChromeTrace()
+        FureyEngine::Profiler::SetThreadName("Main");
+        FureyEngine::Profiler::Start();
+#endif
+
+#if TRACK_ALLOCATIONS
+        // Count allocations from the start, which can be exported with AllocationTracker::ExportJson()
+        FureyEngine::AllocationTracker::Start();
+#endif
+
+        // Register the built-in actors and components so snapshots save and restore them
+        FureyEngine::Snapshot::RegisterActor<FureyEngine::PawnActor>("PawnActor");
+        FureyEngine::Snapshot::RegisterActor<FureyEngine::SpriteActor>("SpriteActor");
+        FureyEngine::Snapshot::RegisterActor<FureyEngine::TextActor>("TextActor");
+        FureyEngine::Snapshot::RegisterActor<FureyEngine::ColliderActor>("ColliderActor");
+        FureyEngine::Snapshot::RegisterActor<FureyEngine::TriggerActor>("TriggerActor");
+        FureyEngine::Snapshot::RegisterComponent<FureyEngine::RenderComponent>(
+            "RenderComponent", [](FureyEngine::Actor *OwningActor) -> FureyEngine::Component * {
+                return OwningActor->AttachComponent<FureyEngine::RenderComponent>(nullptr).Get();
+            });
+        FureyEngine::Snapshot::RegisterComponent<FureyEngine::TextComponent>(
+            "TextComponent", [](FureyEngine::Actor *OwningActor) -> FureyEngine::Component * {
+                return OwningActor->AttachComponent<FureyEngine::TextComponent>(nullptr, "").Get();
+            });
+        FureyEngine::Snapshot::RegisterComponent<FureyEngine::AnimationComponent>(
+            "AnimationComponent", [](FureyEngine::Actor *OwningActor) -> FureyEngine::Component * {
+                return OwningActor->AttachComponent<FureyEngine::AnimationComponent>("main", nullptr).Get();
+            });
+        FureyEngine::Snapshot::RegisterComponent<FureyEngine::CameraComponent>("CameraComponent");
+        FureyEngine::Snapshot::RegisterComponent<FureyEngine::BrushComponent>(
+            "BrushComponent", [](FureyEngine::Actor *OwningActor) -> FureyEngine::Component * {
+                return OwningActor->AttachComponent<FureyEngine::BrushComponent>(FureyEngine::Transform()).Get();
+            });
+        FureyEngine::Snapshot::RegisterComponent<FureyEngine::MovementComponent>("MovementComponent");
+        FureyEngine::Snapshot::RegisterComponent<FureyEngine::PhysicsComponent>("PhysicsComponent");
+
         // Run Furey Engine
         const int Code = FureyEngine::Main(argc, argv);
 
@@ -95,9 +168,13 @@ int main(int argc, char **argv) {
             // Run the game loop
             bool Running = true;
             while (Running) {
+                PROFILE_ZONE("Frame");
+
 #if DEBUG
                 // Check for errors
+#if !HEADLESS
                 GL_ERROR_CHECK;
+#endif
                 SDL_ERROR_CHECK;
 #endif
 
@@ -107,10 +184,12 @@ int main(int argc, char **argv) {
                     break;
                 }
 
-                // Update the current world(s)
-                for (const auto &[WorldName, World]: FureyEngine::Engine::Worlds) {
-                    World->Update();
-                }
+                // Update the current world(s), waiting for isolated worlds to finish before rendering
+                FureyEngine::Engine::UpdateWorlds();
+
+#if !HEADLESS
+                // Measure this loop and refresh the performance overlay if it is shown
+                FureyEngine::PerformanceHUD::Update();
 
                 // Clear the current window(s)
                 for (const auto &RendererName: FureyEngine::Engine::TargetRenderers) {
@@ -121,15 +200,36 @@ int main(int argc, char **argv) {
                 for (const auto &RendererName: FureyEngine::Engine::TargetRenderers) {
                     FureyEngine::Resources::Renderers[RendererName].Render();
                 }
+#endif
 
                 // Call cleanup events
-                FureyEngine::Engine::Cleanup();
-                FureyEngine::Engine::Cleanup.Clear();
+                {
+                    PROFILE_ZONE("Engine::Cleanup");
+                    FureyEngine::Engine::Cleanup();
+                    FureyEngine::Engine::Cleanup.Clear();
+                }
+
+                // Free this loop's temporary memory
+                FureyEngine::FrameArena::ResetAll();
+
+#if TRACK_ALLOCATIONS
+                // Store what this loop allocated under each profiled zone
+                FureyEngine::AllocationTracker::EndFrame();
+#endif
+
+                // Wait for the next loop if the tick rate is limited
+                FureyEngine::Engine::WaitForNextTick();
             }
         }
 
         // Clean up all engine resources
+#if !HEADLESS
+        FureyEngine::PerformanceHUD::Close();
+#endif
         FureyEngine::Engine::Close();
+#if HEADLESS
+        SDL_Quit();
+#endif
 
         return Code;
 #if DEBUG
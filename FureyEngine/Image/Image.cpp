@@ -19,6 +19,34 @@ namespace FureyEngine {
 
         ++TotalImages;
 
+#if HEADLESS
+        // Only read the size of the image since there is no OpenGL context to store its texture in
+        MyPixels = nullptr;
+        SDL_RWops *File = SDL_RWFromFile(Path.c_str(), "rb");
+        if (File == nullptr) {
+            IMG_Quit();
+            throw std::runtime_error("ERROR: IMG failed to load an image!\nSDL Error: " +
+                                     std::string(SDL_GetError()));
+        }
+
+        if (IMG_isPNG(File)) {
+            // The width and height directly follow the PNG signature and IHDR chunk header
+            SDL_RWseek(File, 16, RW_SEEK_SET);
+            MyTextureSize.x = static_cast<int>(SDL_ReadBE32(File));
+            MyTextureSize.y = static_cast<int>(SDL_ReadBE32(File));
+            SDL_RWclose(File);
+        } else {
+            // Other formats are decoded once to find their size
+            SDL_Surface *Surface = IMG_Load_RW(File, 1);
+            if (Surface == nullptr) {
+                IMG_Quit();
+                throw std::runtime_error("ERROR: IMG failed to load an image!\nIMG Error: " +
+                                         std::string(IMG_GetError()));
+            }
+            MyTextureSize = {Surface->w, Surface->h};
+            SDL_FreeSurface(Surface);
+        }
+#else
         // Create a temporary surface with the given image
         SDL_Surface *Surface = IMG_Load(Path.c_str());
         if (Surface == nullptr) {
@@ -77,6 +105,7 @@ namespace FureyEngine {
 
         // Unbind the texture
         glBindTexture(GL_TEXTURE_2D, 0);
+#endif
     }
 
     // Creates a new image of the given size and color.
@@ -95,6 +124,11 @@ namespace FureyEngine {
 
         ++TotalImages;
 
+#if HEADLESS
+        // Only store the size of the image since there is no OpenGL context to store its texture in
+        MyPixels = nullptr;
+        MyTextureSize = Size;
+#else
         // Create a temporary surface with the given size and color
         SDL_Surface *Surface = SDL_CreateRGBSurface(0, Size.x, Size.y, 32,
                                                     0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
@@ -154,6 +188,7 @@ namespace FureyEngine {
 
         // Unbind the texture
         glBindTexture(GL_TEXTURE_2D, 0);
+#endif
     }
 
     // DESTRUCTOR
@@ -11,6 +11,8 @@ namespace FureyEngine {
     // Call this in your main loop to update the user's input as fast as possible.
     // Takes the loop condition as a parameter for quitting logic.
     void Input::Update(bool &LoopCondition) {
+        PROFILE_ZONE("Input::Update");
+
         // Update delta time
         CurrentDeltaTime = static_cast<std::chrono::duration<double>>(
             std::chrono::high_resolution_clock::now() - CurrentTimePoint).count();
@@ -22,8 +24,8 @@ namespace FureyEngine {
         }
 
         // Store each event and input from this tick
-        std::list<::SDL_Event> CurrentEvents;
-        std::list<Sint32> CurrentInputs;
+        FrameVector<::SDL_Event> CurrentEvents;
+        FrameVector<Sint32> CurrentInputs;
 
         // Updates the current event and key
         while (SDL_PollEvent(&MyEvent)) {
@@ -159,7 +161,7 @@ namespace FureyEngine {
 #endif
 
         // Call the current events' corresponding delegate
-        for (const ::SDL_Event Event: CurrentEvents) {
+        for (const ::SDL_Event &Event: CurrentEvents) {
             Events[static_cast<SDL_EventType>(Event.type)](Event);
         }
 
@@ -192,28 +194,30 @@ namespace FureyEngine {
     // KEYBOARD
 
     // Returns the current state of the given key.
+    // This never adds the key, so components may read keys while ticking in parallel.
     ButtonState Input::GetKeyState(const SDL_Keycode &Key) {
-        return KeyStates[Key];
+        const auto State = KeyStates.find(Key);
+        return State != KeyStates.end() ? State->second : ButtonState::UP;
     }
 
     // Returns whether the given key is currently up.
     bool Input::IsKeyUp(const SDL_Keycode &Key) {
-        return KeyStates[Key] == ButtonState::UP;
+        return GetKeyState(Key) == ButtonState::UP;
     }
 
     // Returns whether the given key is currently down.
     bool Input::IsKeyDown(const SDL_Keycode &Key) {
-        return KeyStates[Key] == ButtonState::DOWN;
+        return GetKeyState(Key) == ButtonState::DOWN;
     }
 
     // Returns whether the given key is currently held.
     bool Input::IsKeyHeld(const SDL_Keycode &Key) {
-        return KeyStates[Key] == ButtonState::HELD;
+        return GetKeyState(Key) == ButtonState::HELD;
     }
 
     // Returns whether the given key is currently released.
     bool Input::IsKeyReleased(const SDL_Keycode &Key) {
-        return KeyStates[Key] == ButtonState::RELEASED;
+        return GetKeyState(Key) == ButtonState::RELEASED;
     }
 
     // Starts receiving text input.
@@ -271,28 +275,30 @@ namespace FureyEngine {
     // MOUSE
 
     // Returns the current state of the given mouse button.
+    // This never adds the button, so components may read buttons while ticking in parallel.
     ButtonState Input::GetMouseButtonState(const Uint8 &Button) {
-        return MouseButtonStates[Button];
+        const auto State = MouseButtonStates.find(Button);
+        return State != MouseButtonStates.end() ? State->second : ButtonState::UP;
     }
 
     // Returns whether the given mouse button is currently up.
     bool Input::IsMouseButtonUp(const Uint8 &Button) {
-        return MouseButtonStates[Button] == ButtonState::UP;
+        return GetMouseButtonState(Button) == ButtonState::UP;
     }
 
     // Returns whether the given mouse button is currently down.
     bool Input::IsMouseButtonDown(const Uint8 &Button) {
-        return MouseButtonStates[Button] == ButtonState::DOWN;
+        return GetMouseButtonState(Button) == ButtonState::DOWN;
     }
 
     // Returns whether the given mouse button is currently held.
     bool Input::IsMouseButtonHeld(const Uint8 &Button) {
-        return MouseButtonStates[Button] == ButtonState::HELD;
+        return GetMouseButtonState(Button) == ButtonState::HELD;
     }
 
     // Returns whether the given mouse button is currently released.
     bool Input::IsMouseButtonReleased(const Uint8 &Button) {
-        return MouseButtonStates[Button] == ButtonState::RELEASED;
+        return GetMouseButtonState(Button) == ButtonState::RELEASED;
     }
 
     // MOUSE WHEEL
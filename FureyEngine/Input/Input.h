@@ -6,6 +6,8 @@
 #include "../Math/Math.h"
 #include "../Delegate/Delegate.h"
 #include "../Event/Event.h"
+#include "../FrameArena/FrameArena.h"
+#include "../Profiler/Profiler.h"
 
 #define KEYBOARD_INPUT 1
 #define MOUSE_INPUT 1
@@ -170,7 +172,10 @@ namespace FureyEngine {
 
         // KEYBOARD
 
-        /** Returns the current state of the given key. */
+        /**
+         * Returns the current state of the given key.<br/>
+         * This never adds the key, so components may read keys while ticking in parallel.
+         */
         [[nodiscard]] static ButtonState GetKeyState(const SDL_Keycode &Key);
 
         /** Returns whether the given key is currently up. */
@@ -208,7 +213,10 @@ namespace FureyEngine {
 
         // MOUSE BUTTON
 
-        /** Returns the current state of the given mouse button. */
+        /**
+         * Returns the current state of the given mouse button.<br/>
+         * This never adds the button, so components may read buttons while ticking in parallel.
+         */
         [[nodiscard]] static ButtonState GetMouseButtonState(const Uint8 &Button = LEFT_MOUSE_BUTTON);
 
         /** Returns whether the given mouse button is currently up. */
@@ -0,0 +1,374 @@
+// .cpp
+// Performance Overlay Script
+// by Kyle Furey
+
+#include "PerformanceHUD.h"
+
+namespace FureyEngine {
+    // TEXT
+
+    // Rasterizes each character from the font.
+    void PerformanceHUD::LoadGlyphs() {
+        GlyphFont = std::make_unique<Font>(FontPath, "", FontSize, FontColor);
+        TTF_Font *const LoadedFont = GlyphFont->TTF_Font();
+        LineSkip = TTF_FontLineSkip(LoadedFont);
+
+        for (int Character = PERFORMANCE_HUD_FIRST_GLYPH; Character <= PERFORMANCE_HUD_LAST_GLYPH; ++Character) {
+            Glyph &Loaded = Glyphs[Character - PERFORMANCE_HUD_FIRST_GLYPH];
+            int MinX, MaxX, MinY, MaxY;
+            if (TTF_GlyphMetrics(LoadedFont, static_cast<Uint16>(Character), &MinX, &MaxX, &MinY, &MaxY,
+                                 &Loaded.Advance) != 0) {
+                throw std::runtime_error("ERROR: TTF failed to measure a character of the performance HUD!\n"
+                                         "TTF Error: " + std::string(TTF_GetError()));
+            }
+
+            // Spaces are never drawn, so only their advance is needed
+            if (Character == ' ') {
+                continue;
+            }
+
+            // Create a temporary surface with the character
+            SDL_Surface *Surface;
+#if BLENDED_TEXT
+            Surface = TTF_RenderGlyph_Blended(LoadedFont, static_cast<Uint16>(Character), FontColor);
+#else
+            Surface = TTF_RenderGlyph_Solid(LoadedFont, static_cast<Uint16>(Character), FontColor);
+#endif
+            if (Surface == nullptr) {
+                throw std::runtime_error("ERROR: TTF failed to render a character of the performance HUD!\n"
+                                         "TTF Error: " + std::string(TTF_GetError()));
+            }
+
+            // Generates a new texture and stores its ID
+            glGenTextures(1, &Loaded.ID);
+            if (Loaded.ID == 0) {
+                SDL_FreeSurface(Surface);
+                throw std::runtime_error("ERROR: OpenGL failed to generate a texture!\nOpenGL Error: " +
+                                         std::to_string(glGetError()));
+            }
+
+            // Bind the texture
+            glBindTexture(GL_TEXTURE_2D, Loaded.ID);
+
+            // Clamp the texture so neighboring characters do not bleed into each other's edges
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+            // Reformats the surface
+            SDL_Surface *FormattedSurface = SDL_ConvertSurfaceFormat(Surface, SDL_PIXELFORMAT_RGBA32, 0);
+
+            // Set the size of this character's texture
+            Loaded.Size = {Surface->w, Surface->h};
+
+            // Stores the texture data in the GPU and frees the surface
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, FormattedSurface->w, FormattedSurface->h,
+                         0, GL_RGBA, GL_UNSIGNED_BYTE, FormattedSurface->pixels);
+            SDL_FreeSurface(FormattedSurface);
+            SDL_FreeSurface(Surface);
+
+            // Unbind the texture
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+
+        // Create each cell, which is hidden behind a valid texture until it is laid out
+        const GLuint HiddenID = Glyphs['?' - PERFORMANCE_HUD_FIRST_GLYPH].ID;
+        CellTransforms.assign(PERFORMANCE_HUD_CHARACTERS, Transform());
+        Cells.clear();
+        Cells.reserve(PERFORMANCE_HUD_CHARACTERS);
+        for (auto &CellTransform: CellTransforms) {
+            Cells.emplace_back(HiddenID, glm::ivec2{0, 0}, &CellTransform);
+        }
+        VisibleCells = 0;
+    }
+
+    // Measures the engine and returns the overlay's text.
+    std::string PerformanceHUD::Measure() {
+        std::string Text;
+        char Line[256];
+
+        // Frame times
+        const double Median = FramePercentile(0.5);
+        std::snprintf(Line, sizeof(Line), "Frame  p50 %.2f ms  p95 %.2f ms  p99 %.2f ms  (%.0f FPS)\n",
+                      Median * 1000.0, FramePercentile(0.95) * 1000.0, FramePercentile(0.99) * 1000.0,
+                      Median > 0 ? 1.0 / Median : 0.0);
+        Text += Line;
+
+        // Draw calls, not counting the overlay's own characters
+        const int OverlayDraws = VisibleCells * static_cast<int>(Target->Windows.size());
+        const unsigned long long PairsTested = BrushComponent::PairsTested();
+        std::snprintf(Line, sizeof(Line), "Draw calls %d  Collision pairs tested %llu / frame\n",
+                      std::max(Target->DrawCallCount() - OverlayDraws, 0),
+                      FramesSinceRefresh > 0
+                          ? (PairsTested - PreviousPairsTested) / static_cast<unsigned long long>(FramesSinceRefresh)
+                          : 0ULL);
+        Text += Line;
+        PreviousPairsTested = PairsTested;
+
+#if TRACK_ALLOCATIONS
+        // Allocations of the previous loop
+        const AllocationTracker::AllocationStats Allocated = AllocationTracker::LastFrameTotal();
+        std::snprintf(Line, sizeof(Line), "Allocations %llu (%llu bytes)  Frees %llu / frame\n",
+                      Allocated.Allocations, Allocated.BytesAllocated, Allocated.Frees);
+        Text += Line;
+#endif
+
+        // Each world's tick rate and active actors and components
+        int TotalActive = 0, TotalActors = 0, TotalActiveComponents = 0, TotalComponents = 0;
+        std::map<std::string, unsigned long long> TickCounts;
+        for (const auto &[WorldName, World]: Engine::Worlds) {
+            if (World == nullptr) {
+                continue;
+            }
+
+            int Active = 0, ActiveComponents = 0, Components = 0;
+            for (const auto &Actor: World->Actors) {
+                Active += Actor->IsActive();
+                for (const auto &Component: Actor->Components) {
+                    ActiveComponents += Component->IsActive();
+                    ++Components;
+                }
+            }
+            const int Actors = static_cast<int>(World->Actors.size());
+            TotalActive += Active;
+            TotalActors += Actors;
+            TotalActiveComponents += ActiveComponents;
+            TotalComponents += Components;
+
+            const unsigned long long Ticks = World->TickCount();
+            const auto Previous = PreviousTickCounts.find(WorldName);
+            const unsigned long long Ticked = Previous != PreviousTickCounts.end() && Previous->second <= Ticks
+                                                  ? Ticks - Previous->second
+                                                  : 0;
+            TickCounts[WorldName] = Ticks;
+
+            std::snprintf(Line, sizeof(Line), "%.32s%s  %.0f ticks/s  actors %d / %d  components %d / %d\n",
+                          WorldName.c_str(), WorldName.size() > 32 ? "..." : "",
+                          SinceRefresh > 0 ? static_cast<double>(Ticked) / SinceRefresh : 0.0,
+                          Active, Actors, ActiveComponents, Components);
+            Text += Line;
+        }
+        PreviousTickCounts = std::move(TickCounts);
+
+        std::snprintf(Line, sizeof(Line), "Total  actors %d / %d  components %d / %d",
+                      TotalActive, TotalActors, TotalActiveComponents, TotalComponents);
+        Text += Line;
+        return Text;
+    }
+
+    // Lays out the given text across the character cells without rasterizing it.
+    void PerformanceHUD::Layout(const std::string &Text) {
+        const glm::vec2 TopLeft = {
+            -static_cast<float>(SCREEN_WIDTH) / 2,
+            static_cast<float>(SCREEN_WIDTH) / TARGET_RESOLUTION_RATIO / 2
+        };
+        glm::ivec2 Pen = {PERFORMANCE_HUD_MARGIN, PERFORMANCE_HUD_MARGIN};
+        int Cell = 0;
+
+        for (char Character: Text) {
+            if (Character == '\n') {
+                Pen = {PERFORMANCE_HUD_MARGIN, Pen.y + LineSkip};
+                continue;
+            }
+            if (Character < PERFORMANCE_HUD_FIRST_GLYPH || Character > PERFORMANCE_HUD_LAST_GLYPH) {
+                Character = '?';
+            }
+
+            // Assign the character's texture to the next cell and center the cell on the character
+            const Glyph &Placed = Glyphs[Character - PERFORMANCE_HUD_FIRST_GLYPH];
+            if (Placed.ID != 0 && Cell < PERFORMANCE_HUD_CHARACTERS) {
+                const glm::vec2 Offset = Renderer::PixelsToWorld(Pen) + Renderer::PixelsToWorld(Placed.Size) / 2.0f;
+                Cells[Cell].ID = Placed.ID;
+                Cells[Cell].Size = Placed.Size;
+                CellTransforms[Cell].Position = {TopLeft.x + Offset.x, TopLeft.y - Offset.y};
+                ++Cell;
+            }
+            Pen.x += Placed.Advance;
+        }
+
+        // Hide each unused cell
+        for (int i = Cell; i < VisibleCells; ++i) {
+            Cells[i].Size = {0, 0};
+        }
+        VisibleCells = Cell;
+    }
+
+    // VISIBILITY
+
+    // Shows the overlay on the renderer with the given name.
+    void PerformanceHUD::Show(const std::string &RendererName) {
+#if HEADLESS
+        throw std::runtime_error("ERROR: The performance HUD cannot be shown in a headless build!");
+#else
+        Renderer *const Shown = &Resources::Renderers[RendererName];
+        if (Target == Shown) {
+            return;
+        }
+        Hide();
+
+        // Each character is only rasterized the first time the overlay is shown
+        if (GlyphFont == nullptr) {
+            LoadGlyphs();
+        }
+
+        Target = Shown;
+        for (auto &Cell: Cells) {
+            Target->StaticTextures.push_back(&Cell);
+        }
+
+        // Measure rates from now on, since the overlay may have been hidden for a while
+        SinceRefresh = 0;
+        FramesSinceRefresh = 0;
+        PreviousPairsTested = BrushComponent::PairsTested();
+        PreviousTickCounts.clear();
+        for (const auto &[WorldName, World]: Engine::Worlds) {
+            if (World != nullptr) {
+                PreviousTickCounts[WorldName] = World->TickCount();
+            }
+        }
+#endif
+    }
+
+    // Hides the overlay.
+    void PerformanceHUD::Hide() {
+        if (Target == nullptr) {
+            return;
+        }
+        const std::less<const Texture *> Less;
+        Target->StaticTextures.remove_if([&Less](const Texture *Texture) {
+            return !Less(Texture, Cells.data()) && Less(Texture, Cells.data() + Cells.size());
+        });
+        Target = nullptr;
+    }
+
+    // Shows the overlay if it is hidden, or hides it if it is shown.
+    void PerformanceHUD::Toggle(const std::string &RendererName) {
+        if (IsShown()) {
+            Hide();
+        } else {
+            Show(RendererName);
+        }
+    }
+
+    // Returns whether the overlay is shown.
+    bool PerformanceHUD::IsShown() {
+        return Target != nullptr;
+    }
+
+    // UPDATE
+
+    // Measures the current frame and refreshes the overlay's text once each refresh interval.
+    // This should be called once each engine loop after the worlds are updated and before they are rendered.
+    void PerformanceHUD::Update() {
+        PROFILE_ZONE("PerformanceHUD::Update");
+
+        // Measure the time since the previous update
+        const auto Now = std::chrono::steady_clock::now();
+        if (PreviousUpdate != std::chrono::steady_clock::time_point()) {
+            const double FrameTime = std::chrono::duration<double>(Now - PreviousUpdate).count();
+            FrameTimes[Frames % PERFORMANCE_HUD_FRAMES] = FrameTime;
+            ++Frames;
+            SinceRefresh += FrameTime;
+            ++FramesSinceRefresh;
+        }
+        PreviousUpdate = Now;
+
+        // Only lay out new text once each refresh interval
+        if (Target == nullptr || SinceRefresh < RefreshInterval) {
+            return;
+        }
+        Layout(Measure());
+        SinceRefresh = 0;
+        FramesSinceRefresh = 0;
+    }
+
+    // STATISTICS
+
+    // Returns the given percentile (from 0 to 1) of the recent frame times in seconds.
+    double PerformanceHUD::FramePercentile(const double &Percentile) {
+        const size_t Count = std::min<unsigned long long>(Frames, PERFORMANCE_HUD_FRAMES);
+        if (Count == 0) {
+            return 0;
+        }
+        std::array<double, PERFORMANCE_HUD_FRAMES> Sorted;
+        std::copy_n(FrameTimes.begin(), Count, Sorted.begin());
+        const size_t Index = std::min(static_cast<size_t>(std::clamp(Percentile, 0.0, 1.0) * Count), Count - 1);
+        std::nth_element(Sorted.begin(), Sorted.begin() + static_cast<long>(Index), Sorted.begin() + Count);
+        return Sorted[Index];
+    }
+
+    // CLOSING
+
+    // Hides the overlay and deletes each of its characters' textures.
+    void PerformanceHUD::Close() {
+        Hide();
+        for (auto &Closed: Glyphs) {
+            if (Closed.ID != 0) {
+                glDeleteTextures(1, &Closed.ID);
+            }
+            Closed = {};
+        }
+        Cells.clear();
+        CellTransforms.clear();
+        VisibleCells = 0;
+        GlyphFont = nullptr;
+    }
+
+    // STATIC VARIABLE INITIALIZATION
+
+    // Each character the overlay can show, starting with PERFORMANCE_HUD_FIRST_GLYPH.
+    std::array<PerformanceHUD::Glyph, PERFORMANCE_HUD_LAST_GLYPH - PERFORMANCE_HUD_FIRST_GLYPH + 1>
+    PerformanceHUD::Glyphs;
+
+    // The distance in pixels between each line of the overlay.
+    int PerformanceHUD::LineSkip = 0;
+
+    // The font each character was rasterized from.
+    std::unique_ptr<Font> PerformanceHUD::GlyphFont = nullptr;
+
+    // The transform of each character cell.
+    std::vector<Transform> PerformanceHUD::CellTransforms;
+
+    // Each character cell, which is hidden while its size is zero.
+    std::vector<Texture> PerformanceHUD::Cells;
+
+    // The number of cells showing a character.
+    int PerformanceHUD::VisibleCells = 0;
+
+    // The renderer the overlay is drawn on, or nullptr if the overlay is hidden.
+    Renderer *PerformanceHUD::Target = nullptr;
+
+    // The time in seconds of each recent frame, indexed by its frame number modulo the window.
+    std::array<double, PERFORMANCE_HUD_FRAMES> PerformanceHUD::FrameTimes;
+
+    // The total number of frames measured.
+    unsigned long long PerformanceHUD::Frames = 0;
+
+    // The time point of the previous update.
+    std::chrono::steady_clock::time_point PerformanceHUD::PreviousUpdate;
+
+    // The time in seconds since the text was last refreshed.
+    double PerformanceHUD::SinceRefresh = 0;
+
+    // The number of frames since the text was last refreshed.
+    int PerformanceHUD::FramesSinceRefresh = 0;
+
+    // The total number of brush pairs tested when the text was last refreshed.
+    unsigned long long PerformanceHUD::PreviousPairsTested = 0;
+
+    // The tick count of each world when the text was last refreshed.
+    std::map<std::string, unsigned long long> PerformanceHUD::PreviousTickCounts;
+
+    // The path to the font the overlay is rasterized from.
+    std::string PerformanceHUD::FontPath = ROOT"Resources/Font.ttf";
+
+    // The size of the overlay's font.
+    int PerformanceHUD::FontSize = 18;
+
+    // The color of the overlay's font.
+    SDL_Color PerformanceHUD::FontColor = {255, 255, 0, 255};
+
+    // The number of seconds between each refresh of the overlay's text.
+    double PerformanceHUD::RefreshInterval = 0.25;
+}
@@ -0,0 +1,153 @@
+// .h
+// Performance Overlay Script
+// by Kyle Furey
+
+#pragma once
+#include "../Engine/Engine.h"
+#include "../Components/BrushComponent/BrushComponent.h"
+
+// The number of frames the frame time percentiles are measured over.
+#define PERFORMANCE_HUD_FRAMES 240
+
+// The maximum number of characters the overlay can show at once.
+#define PERFORMANCE_HUD_CHARACTERS 1024
+
+// The first and last characters the overlay can show.
+#define PERFORMANCE_HUD_FIRST_GLYPH ' '
+#define PERFORMANCE_HUD_LAST_GLYPH '~'
+
+// The distance in pixels between the overlay and the top left corner of the screen.
+#define PERFORMANCE_HUD_MARGIN 8
+
+namespace FureyEngine {
+    /**
+     * A static class that overlays frame times and engine statistics on top of a renderer.<br/>
+     * Each character is rasterized once when the overlay is first shown,<br/>
+     * then the overlay is drawn as static textures that are only reassigned when its text is refreshed.<br/>
+     * Toggle the overlay with F3.
+     */
+    class PerformanceHUD final {
+        // ABSTRACT CLASS
+
+        /** Prevents instantiation of this class. */
+        virtual void Abstract() = 0;
+
+        // GLYPHS
+
+        /** A character rasterized into its own texture. */
+        struct Glyph final {
+            /** The ID of this character's texture. */
+            GLuint ID = 0;
+
+            /** The size in pixels of this character's texture. */
+            glm::ivec2 Size = {0, 0};
+
+            /** The distance in pixels to the next character. */
+            int Advance = 0;
+        };
+
+        /** Each character the overlay can show, starting with PERFORMANCE_HUD_FIRST_GLYPH. */
+        static std::array<Glyph, PERFORMANCE_HUD_LAST_GLYPH - PERFORMANCE_HUD_FIRST_GLYPH + 1> Glyphs;
+
+        /** The distance in pixels between each line of the overlay. */
+        static int LineSkip;
+
+        /** The font each character was rasterized from. */
+        static std::unique_ptr<Font> GlyphFont;
+
+        // CELLS
+
+        /** The transform of each character cell. */
+        static std::vector<Transform> CellTransforms;
+
+        /** Each character cell, which is hidden while its size is zero. */
+        static std::vector<Texture> Cells;
+
+        /** The number of cells showing a character. */
+        static int VisibleCells;
+
+        /** The renderer the overlay is drawn on, or nullptr if the overlay is hidden. */
+        static Renderer *Target;
+
+        // STATISTICS
+
+        /** The time in seconds of each recent frame, indexed by its frame number modulo the window. */
+        static std::array<double, PERFORMANCE_HUD_FRAMES> FrameTimes;
+
+        /** The total number of frames measured. */
+        static unsigned long long Frames;
+
+        /** The time point of the previous update. */
+        static std::chrono::steady_clock::time_point PreviousUpdate;
+
+        /** The time in seconds since the text was last refreshed. */
+        static double SinceRefresh;
+
+        /** The number of frames since the text was last refreshed. */
+        static int FramesSinceRefresh;
+
+        /** The total number of brush pairs tested when the text was last refreshed. */
+        static unsigned long long PreviousPairsTested;
+
+        /** The tick count of each world when the text was last refreshed. */
+        static std::map<std::string, unsigned long long> PreviousTickCounts;
+
+        // TEXT
+
+        /** Rasterizes each character from the font. */
+        static void LoadGlyphs();
+
+        /** Measures the engine and returns the overlay's text. */
+        [[nodiscard]] static std::string Measure();
+
+        /** Lays out the given text across the character cells without rasterizing it. */
+        static void Layout(const std::string &Text);
+
+    public:
+        // SETTINGS
+
+        /** The path to the font the overlay is rasterized from. */
+        static std::string FontPath;
+
+        /** The size of the overlay's font. */
+        static int FontSize;
+
+        /** The color of the overlay's font. */
+        static SDL_Color FontColor;
+
+        /** The number of seconds between each refresh of the overlay's text. */
+        static double RefreshInterval;
+
+        // VISIBILITY
+
+        /** Shows the overlay on the renderer with the given name. */
+        static void Show(const std::string &RendererName = "main");
+
+        /** Hides the overlay. */
+        static void Hide();
+
+        /** Shows the overlay if it is hidden, or hides it if it is shown. */
+        static void Toggle(const std::string &RendererName = "main");
+
+        /** Returns whether the overlay is shown. */
+        [[nodiscard]] static bool IsShown();
+
+        // UPDATE
+
+        /**
+         * Measures the current frame and refreshes the overlay's text once each refresh interval.<br/>
+         * This should be called once each engine loop after the worlds are updated and before they are rendered.
+         */
+        static void Update();
+
+        // STATISTICS
+
+        /** Returns the given percentile (from 0 to 1) of the recent frame times in seconds. */
+        [[nodiscard]] static double FramePercentile(const double &Percentile);
+
+        // CLOSING
+
+        /** Hides the overlay and deletes each of its characters' textures. */
+        static void Close();
+    };
+}
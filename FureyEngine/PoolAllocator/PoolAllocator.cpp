@@ -0,0 +1,91 @@
+// .cpp
+// Size Class Pool Allocator Script
+// by Kyle Furey
+
+#include "PoolAllocator.h"
+
+namespace FureyEngine {
+    // OBJECTS
+
+    // Allocates a new chunk and adds each of its objects to the freed objects.
+    void SizeClassPool::AddChunk() {
+        const size_t Objects = NextChunkObjects;
+        Chunks.emplace_back(new unsigned char[ObjectSize * Objects]);
+        NextChunkObjects = std::min<size_t>(NextChunkObjects * 2, POOL_MAX_CHUNK_OBJECTS);
+        TotalObjects += Objects;
+
+        // Link objects in address order so new objects are handed out sequentially
+        unsigned char *const Memory = Chunks.back().get();
+        for (size_t i = Objects; i > 0; --i) {
+            const auto Object = reinterpret_cast<FreeObject *>(Memory + (i - 1) * ObjectSize);
+            Object->Next = FreeObjects;
+            FreeObjects = Object;
+        }
+    }
+
+    // ALLOCATION
+
+    // Returns memory for one object of this pool's size.
+    void *SizeClassPool::Allocate() {
+        std::lock_guard Lock(Mutex);
+        if (FreeObjects == nullptr) {
+            AddChunk();
+        }
+        const auto Object = FreeObjects;
+        FreeObjects = Object->Next;
+        ++LiveObjects;
+        return Object;
+    }
+
+    // Returns the given object's memory to this pool.
+    void SizeClassPool::Deallocate(void *Object) {
+        if (Object == nullptr) {
+            return;
+        }
+        std::lock_guard Lock(Mutex);
+        const auto Freed = static_cast<FreeObject *>(Object);
+        Freed->Next = FreeObjects;
+        FreeObjects = Freed;
+        --LiveObjects;
+    }
+
+    // SIZE
+
+    // Returns the size in bytes of each object in this pool.
+    size_t SizeClassPool::GetObjectSize() const {
+        return ObjectSize;
+    }
+
+    // Returns the number of objects currently allocated from this pool.
+    size_t SizeClassPool::Count() {
+        std::lock_guard Lock(Mutex);
+        return LiveObjects;
+    }
+
+    // Returns the number of objects that fit in this pool's chunks.
+    size_t SizeClassPool::Capacity() {
+        std::lock_guard Lock(Mutex);
+        return TotalObjects;
+    }
+
+    // SIZE CLASSES
+
+    // Returns whether objects of the given size and alignment are allocated from a size class pool.
+    bool SizeClassPool::IsPooled(const size_t &Size, const size_t &Alignment) {
+        return Size <= POOL_MAX_OBJECT_BYTES && Alignment <= POOL_SIZE_CLASS_BYTES &&
+               Alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    }
+
+    // Returns the pool for objects of the given size, which must be pooled.
+    SizeClassPool &SizeClassPool::ForSize(const size_t &Size) {
+        // The pools are never destroyed so objects freed during static destruction are still returned safely
+        static const auto Pools = [] {
+            const auto Created = new SizeClassPool[POOL_MAX_OBJECT_BYTES / POOL_SIZE_CLASS_BYTES];
+            for (size_t i = 0; i < POOL_MAX_OBJECT_BYTES / POOL_SIZE_CLASS_BYTES; ++i) {
+                Created[i].ObjectSize = (i + 1) * POOL_SIZE_CLASS_BYTES;
+            }
+            return Created;
+        }();
+        return Pools[(std::max<size_t>(Size, 1) - 1) / POOL_SIZE_CLASS_BYTES];
+    }
+}
@@ -0,0 +1,170 @@
+// .h
+// Size Class Pool Allocator Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+
+// The number of bytes between each size class.
+#define POOL_SIZE_CLASS_BYTES 16
+
+// The largest object in bytes allocated from a size class pool.
+#define POOL_MAX_OBJECT_BYTES 4096
+
+// The number of objects in the first chunk of each size class pool.
+#define POOL_MIN_CHUNK_OBJECTS 64
+
+// The most objects in each later chunk of each size class pool.
+#define POOL_MAX_CHUNK_OBJECTS 4096
+
+namespace FureyEngine {
+    /**
+     * Allocates objects of one size class from large chunks of memory, reusing freed objects before new ones.<br/>
+     * Objects of the same size are packed together, which keeps them close in memory when iterated.<br/>
+     * Each chunk is twice the size of the last so spawning many objects at once only allocates a few chunks.<br/>
+     * Chunks are kept for reuse until the program exits.
+     */
+    class SizeClassPool final {
+        // OBJECTS
+
+        /** A freed object, which stores the next freed object in its own memory. */
+        struct FreeObject final {
+            /** The next freed object, or nullptr if this is the last one. */
+            FreeObject *Next = nullptr;
+        };
+
+        /** Guards this pool, since worlds may spawn actors on several threads at once. */
+        std::mutex Mutex;
+
+        /** The most recently freed object. */
+        FreeObject *FreeObjects = nullptr;
+
+        /** Each chunk of memory owned by this pool. */
+        std::vector<std::unique_ptr<unsigned char[]> > Chunks;
+
+        /** The size in bytes of each object in this pool. */
+        size_t ObjectSize = 0;
+
+        /** The number of objects the next chunk holds. */
+        size_t NextChunkObjects = POOL_MIN_CHUNK_OBJECTS;
+
+        /** The number of objects currently allocated from this pool. */
+        size_t LiveObjects = 0;
+
+        /** The number of objects that fit in every chunk of this pool combined. */
+        size_t TotalObjects = 0;
+
+        /** Allocates a new chunk and adds each of its objects to the freed objects. */
+        void AddChunk();
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new empty pool. */
+        SizeClassPool() = default;
+
+        /** Delete copy constructor. */
+        SizeClassPool(const SizeClassPool &Copied) = delete;
+
+        /** Delete move constructor. */
+        SizeClassPool(SizeClassPool &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        SizeClassPool &operator=(const SizeClassPool &Copied) = delete;
+
+        /** Delete move constructor. */
+        SizeClassPool &operator=(SizeClassPool &&Moved) = delete;
+
+        // ALLOCATION
+
+        /** Returns memory for one object of this pool's size. */
+        [[nodiscard]] void *Allocate();
+
+        /** Returns the given object's memory to this pool. */
+        void Deallocate(void *Object);
+
+        // SIZE
+
+        /** Returns the size in bytes of each object in this pool. */
+        [[nodiscard]] size_t GetObjectSize() const;
+
+        /** Returns the number of objects currently allocated from this pool. */
+        [[nodiscard]] size_t Count();
+
+        /** Returns the number of objects that fit in this pool's chunks. */
+        [[nodiscard]] size_t Capacity();
+
+        // SIZE CLASSES
+
+        /** Returns whether objects of the given size and alignment are allocated from a size class pool. */
+        [[nodiscard]] static bool IsPooled(const size_t &Size, const size_t &Alignment);
+
+        /** Returns the pool for objects of the given size, which must be pooled. */
+        [[nodiscard]] static SizeClassPool &ForSize(const size_t &Size);
+    };
+
+    /**
+     * An STL allocator that allocates single objects from the size class pool of their size.<br/>
+     * Pass this to std::allocate_shared() so each object and its control block share one pooled allocation.<br/>
+     * Arrays and objects that are too large or too aligned are allocated with operator new instead.
+     */
+    template<typename Type>
+    class PoolAllocator {
+    public:
+        /** The type of object this allocator allocates. */
+        using value_type = Type;
+
+        // CONSTRUCTORS
+
+        /** Constructs a new pool allocator. */
+        PoolAllocator() = default;
+
+        /** Constructs a new pool allocator from a pool allocator of another type. */
+        template<typename OtherType>
+        PoolAllocator(const PoolAllocator<OtherType> &) {
+        }
+
+        // ALLOCATION
+
+        /** Returns memory for the given number of objects. */
+        [[nodiscard]] Type *allocate(const size_t Count) {
+            if (Count == 1 && SizeClassPool::IsPooled(sizeof(Type), alignof(Type))) {
+                return static_cast<Type *>(SizeClassPool::ForSize(sizeof(Type)).Allocate());
+            }
+            if constexpr (alignof(Type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return static_cast<Type *>(::operator new(sizeof(Type) * Count, std::align_val_t(alignof(Type))));
+            } else {
+                return static_cast<Type *>(::operator new(sizeof(Type) * Count));
+            }
+        }
+
+        /** Frees memory for the given number of objects. */
+        void deallocate(Type *Objects, const size_t Count) {
+            if (Count == 1 && SizeClassPool::IsPooled(sizeof(Type), alignof(Type))) {
+                SizeClassPool::ForSize(sizeof(Type)).Deallocate(Objects);
+                return;
+            }
+            if constexpr (alignof(Type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                ::operator delete(Objects, std::align_val_t(alignof(Type)));
+            } else {
+                ::operator delete(Objects);
+            }
+        }
+
+        // EQUALITY
+
+        /** Pool allocators are always equal since they share each size class pool. */
+        template<typename OtherType>
+        [[nodiscard]] bool operator ==(const PoolAllocator<OtherType> &) const {
+            return true;
+        }
+
+        /** Pool allocators are always equal since they share each size class pool. */
+        template<typename OtherType>
+        [[nodiscard]] bool operator !=(const PoolAllocator<OtherType> &) const {
+            return false;
+        }
+    };
+}
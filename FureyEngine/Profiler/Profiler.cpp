@@ -0,0 +1,221 @@
+// .cpp
+// Hierarchical CPU Profiler Script
+// by Kyle Furey
+
+#include "Profiler.h"
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace FureyEngine {
+    // ZONES
+
+    // Returns this thread's buffer, creating it when this thread first records a zone.
+    Profiler::ThreadBuffer &Profiler::CurrentBuffer() {
+        // Each thread returns its buffer to be reused once it exits
+        thread_local const struct BufferOwner final {
+            ThreadBuffer *Buffer;
+
+            BufferOwner() {
+                std::lock_guard Lock(Mutex);
+                if (!FreeBuffers.empty()) {
+                    Buffer = FreeBuffers.back();
+                    FreeBuffers.pop_back();
+                } else {
+                    Buffer = Buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+                }
+                Buffer->Thread = static_cast<unsigned int>(ThreadNames.size());
+                ThreadNames.push_back("Thread " + std::to_string(ThreadNames.size()));
+            }
+
+            ~BufferOwner() {
+                std::lock_guard Lock(Mutex);
+                FreeBuffers.push_back(Buffer);
+            }
+        } Owner;
+        return *Owner.Buffer;
+    }
+
+    // Returns the given zone name, demangling it if it is the name of a type.
+    std::string Profiler::ZoneName(const char *Name) {
+#if defined(__GNUG__)
+        int Status = -1;
+        char *const Demangled = abi::__cxa_demangle(Name, nullptr, nullptr, &Status);
+        if (Status == 0 && Demangled != nullptr) {
+            std::string Result = Demangled;
+            std::free(Demangled);
+            return Result;
+        }
+        std::free(Demangled);
+#endif
+        return Name;
+    }
+
+    // Appends the given text to the given JSON as a string.
+    void Profiler::AppendString(std::string &Json, const std::string &Text) {
+        Json += '"';
+        for (const char Character: Text) {
+            switch (Character) {
+                case '"':
+                    Json += "\\\"";
+                    break;
+                case '\\':
+                    Json += "\\\\";
+                    break;
+                case '\n':
+                    Json += "\\n";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(Character) >= 0x20) {
+                        Json += Character;
+                    }
+                    break;
+            }
+        }
+        Json += '"';
+    }
+
+    // RECORDING
+
+    // Starts recording zones.
+    void Profiler::Start() {
+        Recording.store(true, std::memory_order_relaxed);
+    }
+
+    // Stops recording zones, keeping each recorded zone.
+    void Profiler::Stop() {
+        Recording.store(false, std::memory_order_relaxed);
+    }
+
+    // Returns whether zones are being recorded.
+    bool Profiler::IsRecording() {
+        return Recording.load(std::memory_order_relaxed);
+    }
+
+    // Returns the current time in nanoseconds since the profiler was loaded.
+    long long Profiler::Now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - LoadTimePoint).count();
+    }
+
+    // Records a zone with the given name, start time and end time on this thread.
+    void Profiler::Record(const char *Name, const long long &Start, const long long &End) {
+        ThreadBuffer &Buffer = CurrentBuffer();
+        const unsigned long long Index = Buffer.Recorded.load(std::memory_order_relaxed);
+        Buffer.Zones[Index % PROFILER_BUFFER_ZONES] = {Name, Start, End - Start, Buffer.Thread};
+        Buffer.Recorded.store(Index + 1, std::memory_order_release);
+    }
+
+    // Names this thread in exported traces.
+    void Profiler::SetThreadName(const std::string &Name) {
+        const unsigned int Thread = CurrentBuffer().Thread;
+        std::lock_guard Lock(Mutex);
+        ThreadNames[Thread] = Name;
+    }
+
+    // EXPORT
+
+    // Returns each recorded zone as Chrome trace JSON.
+    // NOTE: This should be called between updates, since zones being recorded at the same time may be skipped.
+    std::string Profiler::ToChromeTrace() {
+        std::lock_guard Lock(Mutex);
+        std::string Json = "{\"traceEvents\":[";
+        bool First = true;
+
+        // Name each thread
+        for (unsigned int Thread = 0; Thread < ThreadNames.size(); ++Thread) {
+            Json += First ? "\n" : ",\n";
+            First = false;
+            Json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(Thread) +
+                    ",\"args\":{\"name\":";
+            AppendString(Json, ThreadNames[Thread]);
+            Json += "}}";
+        }
+
+        // Write each zone still in each buffer as a complete event, demangling each name once
+        std::unordered_map<const char *, std::string> Names;
+        char Times[96];
+        for (const auto &Buffer: Buffers) {
+            const unsigned long long Recorded = Buffer->Recorded.load(std::memory_order_acquire);
+            unsigned long long Index = Buffer->Cleared.load(std::memory_order_relaxed);
+            if (Recorded - Index > PROFILER_BUFFER_ZONES) {
+                Index = Recorded - PROFILER_BUFFER_ZONES;
+            }
+            for (; Index < Recorded; ++Index) {
+                const RecordedZone &Zone = Buffer->Zones[Index % PROFILER_BUFFER_ZONES];
+                auto Name = Names.find(Zone.Name);
+                if (Name == Names.end()) {
+                    Name = Names.emplace(Zone.Name, ZoneName(Zone.Name)).first;
+                }
+                Json += First ? "\n" : ",\n";
+                First = false;
+                Json += "{\"name\":";
+                AppendString(Json, Name->second);
+                std::snprintf(Times, sizeof(Times), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                              static_cast<double>(Zone.Start) / 1000.0, static_cast<double>(Zone.Duration) / 1000.0,
+                              Zone.Thread);
+                Json += Times;
+            }
+        }
+        Json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return Json;
+    }
+
+    // Writes each recorded zone to the given file as Chrome trace JSON.
+    // NOTE: This should be called between updates, since zones being recorded at the same time may be skipped.
+    void Profiler::ExportChromeTrace(const std::string &Path) {
+        std::ofstream File(Path, std::ios::binary);
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to open profiler trace file \"" + Path + "\" for writing!");
+        }
+        const std::string Json = ToChromeTrace();
+        File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to write profiler trace file \"" + Path + "\"!");
+        }
+    }
+
+    // CLEAR
+
+    // Discards each recorded zone.
+    void Profiler::Clear() {
+        std::lock_guard Lock(Mutex);
+        for (const auto &Buffer: Buffers) {
+            Buffer->Cleared.store(Buffer->Recorded.load(std::memory_order_acquire), std::memory_order_relaxed);
+        }
+    }
+
+    // STATIC VARIABLE INITIALIZATION
+
+    // Guards the list of buffers, which is only locked once by each thread and when exporting.
+    std::mutex Profiler::Mutex;
+
+    // Each thread's buffer.
+    std::vector<std::unique_ptr<Profiler::ThreadBuffer> > Profiler::Buffers;
+
+    // Each buffer whose thread has exited.
+    std::vector<Profiler::ThreadBuffer *> Profiler::FreeBuffers;
+
+    // The name of each thread, indexed by thread.
+    std::vector<std::string> Profiler::ThreadNames;
+
+    // Whether zones are being recorded.
+    std::atomic<bool> Profiler::Recording = false;
+
+    // The time point the profiler was loaded, which each zone's time is relative to.
+    const std::chrono::steady_clock::time_point Profiler::LoadTimePoint = std::chrono::steady_clock::now();
+
+    // PROFILE ZONE
+
+    // Starts a new zone with the given name.
+    ProfileZone::ProfileZone(const char *Name)
+        : Name(Name), Start(Profiler::IsRecording() ? Profiler::Now() : -1) {
+    }
+
+    // Records this zone.
+    ProfileZone::~ProfileZone() {
+        if (Start >= 0) {
+            Profiler::Record(Name, Start, Profiler::Now());
+        }
+    }
+}
@@ -0,0 +1,183 @@
+// .h
+// Hierarchical CPU Profiler Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+#include "../AllocationTracker/AllocationTracker.h"
+
+// The number of zones each thread keeps before overwriting its oldest zones.
+#define PROFILER_BUFFER_ZONES 131072
+
+// Joins two tokens after expanding them.
+#define PROFILER_JOIN_TOKENS(Left, Right) Left##Right
+#define PROFILER_JOIN(Left, Right) PROFILER_JOIN_TOKENS(Left, Right)
+
+#if PROFILING && TRACK_ALLOCATIONS
+// Records the time from this line to the end of the enclosing scope as a zone with the given name.
+// Allocations until the end of the enclosing scope are also counted under the zone.
+// The name must outlive the profiler, such as a string literal or the name of a typeid().
+#define PROFILE_ZONE(Name) const FureyEngine::ProfileZone PROFILER_JOIN(ProfiledZone, __LINE__)(Name); \
+    const FureyEngine::AllocationScope PROFILER_JOIN(AllocationScope, __LINE__)(Name)
+#elif PROFILING
+// Records the time from this line to the end of the enclosing scope as a zone with the given name.
+// The name must outlive the profiler, such as a string literal or the name of a typeid().
+#define PROFILE_ZONE(Name) const FureyEngine::ProfileZone PROFILER_JOIN(ProfiledZone, __LINE__)(Name)
+#elif TRACK_ALLOCATIONS
+// Profiling is disabled, so zones only count allocations until the end of the enclosing scope under the zone.
+#define PROFILE_ZONE(Name) const FureyEngine::AllocationScope PROFILER_JOIN(AllocationScope, __LINE__)(Name)
+#else
+// Profiling is disabled, so zones compile to nothing.
+#define PROFILE_ZONE(Name)
+#endif
+
+namespace FureyEngine {
+    /**
+     * A static class that records how long each profiled zone takes on each thread.<br/>
+     * Zones are recorded with PROFILE_ZONE(), which compiles to nothing unless PROFILING or TRACK_ALLOCATIONS is enabled.<br/>
+     * Each thread records into its own ring buffer without locking, overwriting its oldest zones once it is full.<br/>
+     * Recorded zones are exported as a Chrome trace, which can be opened in chrome://tracing or Perfetto.
+     */
+    class Profiler final {
+        // ABSTRACT CLASS
+
+        /** Prevents instantiation of this class. */
+        virtual void Abstract() = 0;
+
+        // ZONES
+
+        /** A zone that has been recorded. */
+        struct RecordedZone final {
+            /** The name of this zone. */
+            const char *Name = nullptr;
+
+            /** The time this zone started in nanoseconds since the profiler was loaded. */
+            long long Start = 0;
+
+            /** The time this zone took in nanoseconds. */
+            long long Duration = 0;
+
+            /** The index of the thread that recorded this zone. */
+            unsigned int Thread = 0;
+        };
+
+        /** The zones recorded by one thread, which is reused by a new thread once its thread exits. */
+        struct ThreadBuffer final {
+            /** Each recorded zone, indexed by the number of zones recorded before it modulo the buffer size. */
+            std::unique_ptr<RecordedZone[]> Zones = std::make_unique<RecordedZone[]>(PROFILER_BUFFER_ZONES);
+
+            /** The number of zones recorded into this buffer, which is only written by its thread. */
+            std::atomic<unsigned long long> Recorded = 0;
+
+            /** The number of recorded zones when this buffer was last cleared. */
+            std::atomic<unsigned long long> Cleared = 0;
+
+            /** The index of the thread currently recording into this buffer. */
+            unsigned int Thread = 0;
+        };
+
+        /** Guards the list of buffers, which is only locked once by each thread and when exporting. */
+        static std::mutex Mutex;
+
+        /** Each thread's buffer. */
+        static std::vector<std::unique_ptr<ThreadBuffer> > Buffers;
+
+        /** Each buffer whose thread has exited. */
+        static std::vector<ThreadBuffer *> FreeBuffers;
+
+        /** The name of each thread, indexed by thread. */
+        static std::vector<std::string> ThreadNames;
+
+        /** Whether zones are being recorded. */
+        static std::atomic<bool> Recording;
+
+        /** The time point the profiler was loaded, which each zone's time is relative to. */
+        static const std::chrono::steady_clock::time_point LoadTimePoint;
+
+        /** Returns this thread's buffer, creating it when this thread first records a zone. */
+        [[nodiscard]] static ThreadBuffer &CurrentBuffer();
+
+        /** Returns the given zone name, demangling it if it is the name of a type. */
+        [[nodiscard]] static std::string ZoneName(const char *Name);
+
+        /** Appends the given text to the given JSON as a string. */
+        static void AppendString(std::string &Json, const std::string &Text);
+
+        /** The allocation tracker names and exports zones the same way. */
+        friend class AllocationTracker;
+
+    public:
+        // RECORDING
+
+        /** Starts recording zones. */
+        static void Start();
+
+        /** Stops recording zones, keeping each recorded zone. */
+        static void Stop();
+
+        /** Returns whether zones are being recorded. */
+        [[nodiscard]] static bool IsRecording();
+
+        /** Returns the current time in nanoseconds since the profiler was loaded. */
+        [[nodiscard]] static long long Now();
+
+        /** Records a zone with the given name, start time and end time on this thread. */
+        static void Record(const char *Name, const long long &Start, const long long &End);
+
+        /** Names this thread in exported traces. */
+        static void SetThreadName(const std::string &Name);
+
+        // EXPORT
+
+        /**
+         * Returns each recorded zone as Chrome trace JSON.<br/>
+         * NOTE: This should be called between updates, since zones being recorded at the same time may be skipped.
+         */
+        [[nodiscard]] static std::string ToChromeTrace();
+
+        /**
+         * Writes each recorded zone to the given file as Chrome trace JSON.<br/>
+         * NOTE: This should be called between updates, since zones being recorded at the same time may be skipped.
+         */
+        static void ExportChromeTrace(const std::string &Path);
+
+        // CLEAR
+
+        /** Discards each recorded zone. */
+        static void Clear();
+    };
+
+    /** Records the time from its construction to its destruction as a zone. Use PROFILE_ZONE() instead of this. */
+    class ProfileZone final {
+        /** The name of this zone. */
+        const char *Name;
+
+        /** The time this zone started, or -1 if the profiler was not recording. */
+        long long Start;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Starts a new zone with the given name. */
+        explicit ProfileZone(const char *Name);
+
+        /** Delete copy constructor. */
+        ProfileZone(const ProfileZone &Copied) = delete;
+
+        /** Delete move constructor. */
+        ProfileZone(ProfileZone &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        ProfileZone &operator=(const ProfileZone &Copied) = delete;
+
+        /** Delete move constructor. */
+        ProfileZone &operator=(ProfileZone &&Moved) = delete;
+
+        // DESTRUCTOR
+
+        /** Records this zone. */
+        ~ProfileZone();
+    };
+}
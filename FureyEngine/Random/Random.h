@@ -0,0 +1,106 @@
+// .h
+// Random Number Generator Class Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+
+namespace FureyEngine {
+    /**
+     * A fast seeded pseudorandom number generator (xoshiro256**).<br/>
+     * Generators with the same seed produce the same sequence of numbers on every platform,<br/>
+     * so simulations that only use seeded generators can be replayed exactly.
+     */
+    class Random final {
+        // STATE
+
+        /** The current state of this generator. */
+        unsigned long long State[4] = {0, 0, 0, 0};
+
+        /** The seed this generator was last seeded with. */
+        unsigned long long MySeed = 0;
+
+        /** Returns the given value rotated left by the given number of bits. */
+        [[nodiscard]] static unsigned long long RotateLeft(const unsigned long long &Value, const int &Bits) {
+            return Value << Bits | Value >> (64 - Bits);
+        }
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new generator with a nondeterministic seed. */
+        Random() {
+            Seed(static_cast<unsigned long long>(std::random_device()()) << 32 | std::random_device()());
+        }
+
+        /** Constructs a new generator with the given seed. */
+        explicit Random(const unsigned long long &Seed) {
+            this->Seed(Seed);
+        }
+
+        // SEED
+
+        /** Restarts this generator's sequence from the given seed. */
+        void Seed(const unsigned long long &Seed) {
+            MySeed = Seed;
+
+            // Expand the seed into the full state with SplitMix64 so similar seeds produce unrelated sequences
+            unsigned long long Mixed = Seed;
+            for (auto &Word: State) {
+                unsigned long long Value = Mixed += 0x9E3779B97F4A7C15ULL;
+                Value = (Value ^ Value >> 30) * 0xBF58476D1CE4E5B9ULL;
+                Value = (Value ^ Value >> 27) * 0x94D049BB133111EBULL;
+                Word = Value ^ Value >> 31;
+            }
+        }
+
+        /** Returns the seed this generator was last seeded with. */
+        [[nodiscard]] unsigned long long GetSeed() const {
+            return MySeed;
+        }
+
+        // NUMBERS
+
+        /** Returns the next 64 random bits in this generator's sequence. */
+        unsigned long long Next() {
+            const unsigned long long Result = RotateLeft(State[1] * 5, 7) * 9;
+            const unsigned long long Shifted = State[1] << 17;
+            State[2] ^= State[0];
+            State[3] ^= State[1];
+            State[1] ^= State[2];
+            State[0] ^= State[3];
+            State[2] ^= Shifted;
+            State[3] = RotateLeft(State[3], 45);
+            return Result;
+        }
+
+        /** Returns a random number from 0 (inclusive) to 1 (exclusive). */
+        double Value() {
+            return static_cast<double>(Next() >> 11) * 0x1.0p-53;
+        }
+
+        /** Returns a random integer from the given minimum to the given maximum (both inclusive). */
+        int Range(const int &Min, const int &Max) {
+            if (Max <= Min) {
+                return Min;
+            }
+            const auto Count = static_cast<unsigned long long>(static_cast<long long>(Max) - Min + 1);
+            return static_cast<int>(Min + static_cast<long long>(Next() % Count));
+        }
+
+        /** Returns a random number from the given minimum (inclusive) to the given maximum (exclusive). */
+        double Range(const double &Min, const double &Max) {
+            return Min + (Max - Min) * Value();
+        }
+
+        /** Returns a random number from the given minimum (inclusive) to the given maximum (exclusive). */
+        float Range(const float &Min, const float &Max) {
+            return Min + (Max - Min) * static_cast<float>(Value());
+        }
+
+        /** Returns true with the given probability from 0 to 1. */
+        bool Chance(const double &Probability) {
+            return Value() < Probability;
+        }
+    };
+}
@@ -0,0 +1,77 @@
+// .cpp
+// Weak Reference Class Script
+// by Kyle Furey
+
+#include "Reference.h"
+
+namespace FureyEngine {
+    // HANDLES
+
+    // Registers and returns a new valid handle.
+    ReferenceHandle ReferenceRegistry::Register() {
+        std::lock_guard Lock(Mutex);
+
+        // Allocate a new chunk of slots if there are no free slots
+        if (FirstFree == Capacity) {
+            if (Capacity / REFERENCE_CHUNK_SIZE >= REFERENCE_MAX_CHUNKS) {
+                throw std::runtime_error("ERROR: Exceeded the maximum number of referenced objects!");
+            }
+            Slot *Chunk = Chunks[Capacity / REFERENCE_CHUNK_SIZE] = new Slot[REFERENCE_CHUNK_SIZE];
+            for (unsigned int i = 0; i < REFERENCE_CHUNK_SIZE; ++i) {
+                Chunk[i].NextFree = Capacity + i + 1;
+            }
+            Capacity += REFERENCE_CHUNK_SIZE;
+        }
+
+        // Claim the first free slot
+        const unsigned int Index = FirstFree;
+        Slot &Claimed = Chunks[Index / REFERENCE_CHUNK_SIZE][Index % REFERENCE_CHUNK_SIZE];
+        FirstFree = Claimed.NextFree;
+        ++Registered;
+        return {Index, Claimed.Generation.load(std::memory_order_relaxed)};
+    }
+
+    // Invalidates the given handle and frees its slot for reuse.
+    void ReferenceRegistry::Release(const ReferenceHandle &Handle) {
+        if (!IsValid(Handle)) {
+            return;
+        }
+
+        std::lock_guard Lock(Mutex);
+
+        // Advance the generation so existing handles to this slot become invalid
+        Slot &Released = Chunks[Handle.Index / REFERENCE_CHUNK_SIZE][Handle.Index % REFERENCE_CHUNK_SIZE];
+        unsigned int Generation = Released.Generation.load(std::memory_order_relaxed) + 1;
+        if (Generation == 0) {
+            Generation = 1;
+        }
+        Released.Generation.store(Generation, std::memory_order_relaxed);
+
+        // Push this slot onto the free list
+        Released.NextFree = FirstFree;
+        FirstFree = Handle.Index;
+        --Registered;
+    }
+
+    // Returns the number of currently registered handles.
+    int ReferenceRegistry::Count() {
+        return Registered;
+    }
+
+    // STATIC VARIABLE INITIALIZATION
+
+    // Each chunk of slots, which are never moved or freed once allocated so handles stay checkable at exit.
+    ReferenceRegistry::Slot *ReferenceRegistry::Chunks[REFERENCE_MAX_CHUNKS];
+
+    // The total number of slots that have ever been allocated.
+    unsigned int ReferenceRegistry::Capacity = 0;
+
+    // The index of the first free slot, or the capacity if there are no free slots.
+    unsigned int ReferenceRegistry::FirstFree = 0;
+
+    // The number of currently registered handles.
+    int ReferenceRegistry::Registered = 0;
+
+    // Guards registering and releasing handles.
+    std::mutex ReferenceRegistry::Mutex;
+}
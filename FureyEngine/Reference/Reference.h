@@ -8,98 +8,228 @@
 // Represents a reference with no associated value.
 #define nullref {}
 
+// The number of slots allocated at once by the reference registry.
+#define REFERENCE_CHUNK_SIZE 4096
+
+// The maximum number of slot chunks the reference registry can allocate.
+#define REFERENCE_MAX_CHUNKS 4096
+
 namespace FureyEngine {
+    /** A generational index that identifies a single registered world, actor or component. */
+    struct ReferenceHandle final {
+        /** The index of this handle's slot in the reference registry. */
+        unsigned int Index = 0;
+
+        /** The generation of the slot when this handle was registered, or 0 if this handle is null. */
+        unsigned int Generation = 0;
+    };
+
+    /**
+     * A global generational slot map that tracks whether each referenced object is still alive.<br/>
+     * Checking a handle is a single non-atomic comparison, and registering or releasing a handle is O(1).
+     */
+    class ReferenceRegistry final {
+        // ABSTRACT CLASS
+
+        /** Prevents instantiation of this class. */
+        virtual void Abstract() = 0;
+
+        // SLOTS
+
+        /** A single slot in the registry. */
+        struct Slot final {
+            /** The current generation of this slot, which is incremented each time it is released. */
+            std::atomic<unsigned int> Generation = 1;
+
+            /** The index of the next free slot after this one if this slot is free. */
+            unsigned int NextFree = 0;
+        };
+
+        /** Each chunk of slots, which are never moved or freed once allocated so handles stay checkable at exit. */
+        static Slot *Chunks[REFERENCE_MAX_CHUNKS];
+
+        /** The total number of slots that have ever been allocated. */
+        static unsigned int Capacity;
+
+        /** The index of the first free slot, or the capacity if there are no free slots. */
+        static unsigned int FirstFree;
+
+        /** The number of currently registered handles. */
+        static int Registered;
+
+        /** Guards registering and releasing handles. */
+        static std::mutex Mutex;
+
+    public:
+        // HANDLES
+
+        /** Registers and returns a new valid handle. */
+        static ReferenceHandle Register();
+
+        /** Invalidates the given handle and frees its slot for reuse. */
+        static void Release(const ReferenceHandle &Handle);
+
+        /** Returns whether the given handle has not been released yet. */
+        [[nodiscard]] static bool IsValid(const ReferenceHandle &Handle) {
+            return Handle.Generation != 0 &&
+                   Chunks[Handle.Index / REFERENCE_CHUNK_SIZE][Handle.Index % REFERENCE_CHUNK_SIZE].Generation.load(
+                       std::memory_order_relaxed) == Handle.Generation;
+        }
+
+        /** Returns the number of currently registered handles. */
+        [[nodiscard]] static int Count();
+    };
+
+    /**
+     * Owns a handle in the reference registry for the lifetime of the object it is a member of.<br/>
+     * Declare this before any other member so the handle stays valid while the other members are destroyed.
+     */
+    class ReferenceSlot final {
+        /** The handle this slot owns. */
+        ReferenceHandle MyHandle = ReferenceRegistry::Register();
+
+    public:
+        // CONSTRUCTORS
+
+        /** Registers a new handle. */
+        ReferenceSlot() = default;
+
+        /** Delete copy constructor. */
+        ReferenceSlot(const ReferenceSlot &Copied) = delete;
+
+        /** Delete move constructor. */
+        ReferenceSlot(ReferenceSlot &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        ReferenceSlot &operator=(const ReferenceSlot &Copied) = delete;
+
+        /** Delete move constructor. */
+        ReferenceSlot &operator=(ReferenceSlot &&Moved) = delete;
+
+        // DESTRUCTOR
+
+        /** Releases this slot's handle. */
+        ~ReferenceSlot() {
+            ReferenceRegistry::Release(MyHandle);
+        }
+
+        // HANDLE
+
+        /** Returns this slot's handle. */
+        [[nodiscard]] const ReferenceHandle &Handle() const {
+            return MyHandle;
+        }
+
+        /** Releases this slot's handle and registers a new one, invalidating each existing reference to its object. */
+        void Renew() {
+            ReferenceRegistry::Release(MyHandle);
+            MyHandle = ReferenceRegistry::Register();
+        }
+    };
+
     /**
      * Represents a weak pointer to an object.<br/>
-     * You can use these to store references to a component, an actor, or a world without extending its lifetime.
+     * You can use these to store references to a component, an actor, or a world without extending its lifetime.<br/>
+     * References store a raw pointer and a generational handle, so checking and dereferencing them is O(1) and atomic-free.
      */
     template<typename Type>
     class Reference {
         // DATA
 
-        /** The underlying weak pointer of this class. */
-        std::weak_ptr<Type> Pointer;
+        /** The referenced object, which is only safe to use while the handle is valid. */
+        Type *Pointer = nullptr;
+
+        /** The handle of the referenced object. */
+        ReferenceHandle Handle;
+
+        /** Throws an error if this reference is no longer valid. */
+        void Validate() const {
+            if (!ReferenceRegistry::IsValid(Handle)) {
+                throw std::runtime_error("ERROR: Attempting to dereference a null reference!\n"
+                    "You need check if the reference is still valid before using it!");
+            }
+        }
 
     public:
         // CONSTRUCTORS
 
+        /** Constructs a new null reference. */
+        Reference() = default;
+
         /** Constructs a new reference from a weak pointer. */
-        Reference(const std::weak_ptr<Type> &Pointer = nullref) : Pointer(Pointer) {
+        Reference(const std::weak_ptr<Type> &Pointer) : Reference(Pointer.lock()) {
         }
 
         /** Constructs a new reference from a shared pointer. */
-        Reference(const std::shared_ptr<Type> &Pointer) : Pointer(Pointer) {
+        Reference(const std::shared_ptr<Type> &Pointer) : Reference(Pointer.get()) {
         }
 
         /** Constructs a new reference from a raw pointer. */
-        Reference(Type *Pointer) : Pointer(std::dynamic_pointer_cast<Type>(Pointer->shared_from_this())) {
+        Reference(Type *Pointer) : Pointer(Pointer) {
+            if (Pointer != nullptr) {
+                Handle = Pointer->GetHandle();
+            }
         }
 
         // CONVERSIONS
 
         /** Converts this reference into a weak pointer. */
-        explicit operator std::weak_ptr<Type> *&() {
-            return Pointer;
+        explicit operator std::weak_ptr<Type>() const {
+            if (!ReferenceRegistry::IsValid(Handle)) {
+                return {};
+            }
+            return std::dynamic_pointer_cast<Type>(Pointer->shared_from_this());
         }
 
         /** Converts this reference into a raw pointer. */
-        explicit operator Type *() {
-            if (Pointer.expired()) {
-                throw std::runtime_error("ERROR: Attempting to dereference a null reference!\n"
-                    "You need check if the reference is still valid before using it!");
-            }
-            return Pointer.lock().get();
+        explicit operator Type *() const {
+            Validate();
+            return Pointer;
+        }
+
+        /** Returns the referenced object, or nullptr if this reference is no longer valid. */
+        [[nodiscard]] Type *Get() const {
+            return ReferenceRegistry::IsValid(Handle) ? Pointer : nullptr;
+        }
+
+        /** Returns the handle of the referenced object. */
+        [[nodiscard]] const ReferenceHandle &GetHandle() const {
+            return Handle;
         }
 
         // DEREFERENCE
 
         /** Converts this reference into a raw pointer. */
         [[nodiscard]] Type &operator*() const {
-            if (Pointer.expired()) {
-                throw std::runtime_error("ERROR: Attempting to dereference a null reference!\n"
-                    "You need check if the reference is still valid before using it!");
-            }
-            return *Pointer.lock().get();
+            Validate();
+            return *Pointer;
         }
 
         /** Converts this reference into a raw pointer. */
         [[nodiscard]] Type *operator ->() const {
-            if (Pointer.expired()) {
-                throw std::runtime_error("ERROR: Attempting to dereference a null reference!\n"
-                    "You need check if the reference is still valid before using it!");
-            }
-            return Pointer.lock().get();
+            Validate();
+            return Pointer;
         }
 
         // COMPARISON
 
         /** Returns whether the given references are equal. */
         [[nodiscard]] bool operator==(const Reference &Other) const {
-            if (Pointer.expired()) {
-                return Other.Pointer.expired();
-            }
-            if (Other.Pointer.expired()) {
-                return false;
-            }
-            return Pointer.lock() == Other.Pointer.lock();
+            return Get() == Other.Get();
         }
 
         /** Returns whether the given references are not equal. */
         [[nodiscard]] bool operator!=(const Reference &Other) const {
-            if (Pointer.expired()) {
-                return !Other.Pointer.expired();
-            }
-            if (Other.Pointer.expired()) {
-                return true;
-            }
-            return Pointer.lock() != Other.Pointer.lock();
+            return Get() != Other.Get();
         }
 
         // SAFETY
 
         /** Returns whether this reference is still valid. */
         [[nodiscard]] explicit operator bool() const {
-            return !Pointer.expired();
+            return ReferenceRegistry::IsValid(Handle);
         }
     };
 }
@@ -130,6 +130,11 @@ namespace FureyEngine {
         return ProjectionParameter;
     }
 
+    // Returns the number of textures drawn by the last call to Render(), including its background.
+    int Renderer::DrawCallCount() const {
+        return DrawCalls;
+    }
+
     // Returns the total number of renderers open.
     int Renderer::Total() {
         return TotalRenderers;
@@ -138,7 +143,8 @@ namespace FureyEngine {
     // RENDERING
 
     // Draws the given texture on the screen if it is visible.
-    void Renderer::DrawTexture(const Texture *Texture) const {
+    // Dynamic textures are drawn between their previous and current transform if they are interpolated.
+    void Renderer::DrawTexture(const Texture *Texture, const bool &Interpolate) const {
         if (Texture->ID == 0) {
             throw std::runtime_error("ERROR: Attempting to draw an empty texture!");
         }
@@ -157,8 +163,13 @@ namespace FureyEngine {
             return;
         }
 
-        // Copy the transform
-        Transform Transform = *Texture->Transform;
+        // Copy the transform, interpolating it between fixed simulation steps
+        Transform Transform = Interpolate && Texture->PreviousTransform != nullptr &&
+                              Texture->Interpolation != nullptr && *Texture->Interpolation < 1
+                                  ? FureyEngine::Transform::Interpolate(*Texture->PreviousTransform,
+                                                                        *Texture->Transform,
+                                                                        static_cast<float>(*Texture->Interpolation))
+                                  : *Texture->Transform;
 
         // Adjust the position relative to this renderer's location and resolution
         Transform.Position.x -= Position.x;
@@ -186,10 +197,14 @@ namespace FureyEngine {
         glBindTexture(GL_TEXTURE_2D, Texture->ID);
         glBindVertexArray(VertexArray);
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+        ++DrawCalls;
     }
 
     // Renders this renderer's textures relative to its current position.
     void Renderer::Render() const {
+        PROFILE_ZONE("Renderer::Render");
+        DrawCalls = 0;
+
         // Render for each window
         for (const auto Window: Windows) {
             // Set the current window
@@ -226,6 +241,7 @@ namespace FureyEngine {
                 glBindTexture(GL_TEXTURE_2D, Background);
                 glBindVertexArray(VertexArray);
                 glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+                ++DrawCalls;
             }
 
             // Render each dynamic texture
@@ -239,7 +255,7 @@ namespace FureyEngine {
                 Texture->Transform->Position.x += Position.x;
                 Texture->Transform->Position.y += Position.y;
 
-                DrawTexture(Texture);
+                DrawTexture(Texture, false);
 
                 // Move the texture back to its initial position
                 Texture->Transform->Position.x -= Position.x;
@@ -247,6 +263,7 @@ namespace FureyEngine {
             }
 
             // Update the window
+            PROFILE_ZONE("SDL_GL_SwapWindow");
             SDL_GL_SwapWindow(Window->SDL_Window());
         }
 
@@ -256,6 +273,8 @@ namespace FureyEngine {
 
     // Clears the screen.
     void Renderer::Clear() const {
+        PROFILE_ZONE("Renderer::Clear");
+
         // Clear each window
         for (const auto Window: Windows) {
             // Set the current window
@@ -268,6 +287,8 @@ namespace FureyEngine {
 
     // Clears the screen with the given color.
     void Renderer::Clear(const SDL_Color &ClearColor) const {
+        PROFILE_ZONE("Renderer::Clear");
+
         // Clear each window
         for (const auto Window: Windows) {
             // Set the current window
@@ -7,6 +7,7 @@
 #include "../Shader/Shader.h"
 #include "../Quad/Quad.h"
 #include "../Texture/Texture.h"
+#include "../Profiler/Profiler.h"
 
 #define SCREEN_WIDTH 100
 #define UNIFORM_TEXTURE_PARAMETER "texture1"
@@ -38,6 +39,11 @@ namespace FureyEngine {
         /** Stores the uniform projection matrix parameter. */
         GLint ProjectionParameter = 0;
 
+        // DRAW CALLS
+
+        /** The number of textures drawn by the last call to Render(). */
+        mutable int DrawCalls = 0;
+
         // TOTAL RENDERERS
 
         /** The total number of renderers open. */
@@ -45,8 +51,11 @@ namespace FureyEngine {
 
         // RENDERING
 
-        /** Draws the given texture on the screen if it is visible. */
-        void DrawTexture(const Texture *Texture) const;
+        /**
+         * Draws the given texture on the screen if it is visible.<br/>
+         * Dynamic textures are drawn between their previous and current transform if they are interpolated.
+         */
+        void DrawTexture(const Texture *Texture, const bool &Interpolate = true) const;
 
     public:
         // RENDERER
@@ -124,6 +133,9 @@ namespace FureyEngine {
         /** Returns the ID of the uniform projection matrix parameter. */
         [[nodiscard]] GLint UniformProjection() const;
 
+        /** Returns the number of textures drawn by the last call to Render(), including its background. */
+        [[nodiscard]] int DrawCallCount() const;
+
         /** Returns the total number of renderers open. */
         [[nodiscard]] static int Total();
 
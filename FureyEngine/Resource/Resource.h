@@ -74,5 +74,21 @@ namespace FureyEngine {
         [[nodiscard]] bool Contains(const std::string &Key) {
             return MyResource.count(Key);
         }
+
+        /** Returns the name of the given resource, or an empty string if it is not stored in this resource. */
+        [[nodiscard]] std::string Find(const ValueType *Value) const {
+            for (const auto &[Key, Stored]: MyResource) {
+                if (&Stored == Value) {
+                    return Key;
+                }
+            }
+            return "";
+        }
+
+        /** Returns the resource with the given name, or nullptr if it is not present. */
+        [[nodiscard]] ValueType *Find(const std::string &Key) {
+            const auto Found = MyResource.find(Key);
+            return Found != MyResource.end() ? &Found->second : nullptr;
+        }
     };
 }
@@ -0,0 +1,312 @@
+// .cpp
+// World Snapshot Class Script
+// by Kyle Furey
+
+#include "Snapshot.h"
+
+// The identifier at the start of each snapshot file.
+#define SNAPSHOT_MAGIC 0x4E534546u
+
+// The shortest repeated sequence an LZ4 block can reference.
+#define MIN_MATCH 4
+
+// The number of bytes at the end of an LZ4 block that are always stored as literals.
+#define LAST_LITERALS 5
+
+// The number of bytes at the end of an LZ4 block that cannot start a match.
+#define MATCH_LIMIT 12
+
+// The number of bits used to hash sequences while compressing.
+#define HASH_BITS 16
+
+namespace FureyEngine {
+    // TYPES
+
+    // Registers the given actor type, replacing its previous registration if it has one.
+    void Snapshot::RegisterActorType(const std::type_index &Type, RegisteredActor Registered) {
+        const auto Found = ActorTypesByType.find(Type);
+        if (Found != ActorTypesByType.end()) {
+            ActorTypes[Found->second] = std::move(Registered);
+            return;
+        }
+        ActorTypesByType[Type] = static_cast<int>(ActorTypes.size());
+        ActorTypes.push_back(std::move(Registered));
+    }
+
+    // Registers the given component type, replacing its previous registration if it has one.
+    void Snapshot::RegisterComponentType(const std::type_index &Type, RegisteredComponent Registered) {
+        const auto Found = ComponentTypesByType.find(Type);
+        if (Found != ComponentTypesByType.end()) {
+            ComponentTypes[Found->second] = std::move(Registered);
+            return;
+        }
+        ComponentTypesByType[Type] = static_cast<int>(ComponentTypes.size());
+        ComponentTypes.push_back(std::move(Registered));
+    }
+
+    // Returns the registered actor type of the given type, or nullptr if it is not registered.
+    const Snapshot::RegisteredActor *Snapshot::FindActorType(const std::type_index &Type) {
+        const auto Found = ActorTypesByType.find(Type);
+        return Found != ActorTypesByType.end() ? &ActorTypes[Found->second] : nullptr;
+    }
+
+    // Returns the registered actor type with the given name, or nullptr if it is not registered.
+    const Snapshot::RegisteredActor *Snapshot::FindActorType(const std::string &TypeName) {
+        for (const auto &Type: ActorTypes) {
+            if (Type.Name == TypeName) {
+                return &Type;
+            }
+        }
+        return nullptr;
+    }
+
+    // Returns the registered component type of the given type, or nullptr if it is not registered.
+    const Snapshot::RegisteredComponent *Snapshot::FindComponentType(const std::type_index &Type) {
+        const auto Found = ComponentTypesByType.find(Type);
+        return Found != ComponentTypesByType.end() ? &ComponentTypes[Found->second] : nullptr;
+    }
+
+    // Returns the registered component type with the given name, or nullptr if it is not registered.
+    const Snapshot::RegisteredComponent *Snapshot::FindComponentType(const std::string &TypeName) {
+        for (const auto &Type: ComponentTypes) {
+            if (Type.Name == TypeName) {
+                return &Type;
+            }
+        }
+        return nullptr;
+    }
+
+    // DATA
+
+    // Returns the size in bytes of this snapshot once compressed.
+    size_t Snapshot::Size() const {
+        return CompressedBytes.size();
+    }
+
+    // Returns the size in bytes of this snapshot before it was compressed.
+    size_t Snapshot::UncompressedSize() const {
+        return RawSize;
+    }
+
+    // Returns whether this snapshot contains nothing.
+    bool Snapshot::IsEmpty() const {
+        return RawSize == 0;
+    }
+
+    // FILES
+
+    // Writes this snapshot to the given file.
+    // NOTE: Scheduled event functions are not written.
+    void Snapshot::SaveToFile(const std::string &Path) const {
+        std::ofstream File(Path, std::ios::binary);
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to open snapshot file \"" + Path + "\" for writing!");
+        }
+
+        const unsigned int Magic = SNAPSHOT_MAGIC;
+        const unsigned int Version = SNAPSHOT_VERSION;
+        const auto Raw = static_cast<unsigned long long>(RawSize);
+        File.write(reinterpret_cast<const char *>(&Magic), sizeof(Magic));
+        File.write(reinterpret_cast<const char *>(&Version), sizeof(Version));
+        File.write(reinterpret_cast<const char *>(&Raw), sizeof(Raw));
+        File.write(reinterpret_cast<const char *>(CompressedBytes.data()),
+                   static_cast<std::streamsize>(CompressedBytes.size()));
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to write snapshot file \"" + Path + "\"!");
+        }
+    }
+
+    // Reads a snapshot from the given file.
+    Snapshot Snapshot::LoadFromFile(const std::string &Path) {
+        std::ifstream File(Path, std::ios::binary | std::ios::ate);
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to open snapshot file \"" + Path + "\" for reading!");
+        }
+
+        const auto FileSize = static_cast<size_t>(File.tellg());
+        File.seekg(0);
+        unsigned int Magic = 0;
+        unsigned int Version = 0;
+        unsigned long long Raw = 0;
+        File.read(reinterpret_cast<char *>(&Magic), sizeof(Magic));
+        File.read(reinterpret_cast<char *>(&Version), sizeof(Version));
+        File.read(reinterpret_cast<char *>(&Raw), sizeof(Raw));
+        if (!File || Magic != SNAPSHOT_MAGIC) {
+            throw std::runtime_error("ERROR: \"" + Path + "\" is not a snapshot file!");
+        }
+        if (Version != SNAPSHOT_VERSION) {
+            throw std::runtime_error("ERROR: Snapshot file \"" + Path + "\" is version " + std::to_string(Version) +
+                                     " but this engine reads version " + std::to_string(SNAPSHOT_VERSION) + "!");
+        }
+
+        Snapshot Loaded;
+        Loaded.RawSize = static_cast<size_t>(Raw);
+        Loaded.CompressedBytes.resize(FileSize - sizeof(Magic) - sizeof(Version) - sizeof(Raw));
+        File.read(reinterpret_cast<char *>(Loaded.CompressedBytes.data()),
+                  static_cast<std::streamsize>(Loaded.CompressedBytes.size()));
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to read snapshot file \"" + Path + "\"!");
+        }
+        return Loaded;
+    }
+
+    // COMPRESSION
+
+    // Compresses the given bytes into an LZ4 block.
+    // Repeated sequences are replaced by references to their previous occurrence within the last 64 KB.
+    std::vector<unsigned char> Snapshot::Compress(const unsigned char *Bytes, const size_t &Count) {
+        std::vector<unsigned char> Compressed;
+        Compressed.reserve(Count + Count / 255 + 16);
+
+        // Writes a length that did not fit in a token
+        const auto WriteLength = [&Compressed](size_t Length) {
+            while (Length >= 255) {
+                Compressed.push_back(255);
+                Length -= 255;
+            }
+            Compressed.push_back(static_cast<unsigned char>(Length));
+        };
+
+        // Writes the given literals followed by a match of the given length and offset, if any
+        const auto WriteSequence = [&](const size_t &LiteralStart, const size_t &LiteralCount,
+                                       const size_t &MatchLength, const size_t &Offset) {
+            const size_t LiteralToken = std::min<size_t>(LiteralCount, 15);
+            const size_t MatchToken = MatchLength > 0 ? std::min<size_t>(MatchLength - MIN_MATCH, 15) : 0;
+            Compressed.push_back(static_cast<unsigned char>(LiteralToken << 4 | MatchToken));
+            if (LiteralToken == 15) {
+                WriteLength(LiteralCount - 15);
+            }
+            Compressed.insert(Compressed.end(), Bytes + LiteralStart, Bytes + LiteralStart + LiteralCount);
+            if (MatchLength > 0) {
+                Compressed.push_back(static_cast<unsigned char>(Offset & 0xFF));
+                Compressed.push_back(static_cast<unsigned char>(Offset >> 8 & 0xFF));
+                if (MatchToken == 15) {
+                    WriteLength(MatchLength - MIN_MATCH - 15);
+                }
+            }
+        };
+
+        // Returns the four bytes at the given position
+        const auto Read32 = [Bytes](const size_t &Position) {
+            unsigned int Value;
+            std::memcpy(&Value, Bytes + Position, sizeof(Value));
+            return Value;
+        };
+
+        // Find repeated sequences by remembering the last position of each hashed sequence
+        size_t Anchor = 0;
+        if (Count > MATCH_LIMIT) {
+            std::vector<unsigned int> Table(1 << HASH_BITS, 0);
+            size_t Position = 0;
+            size_t Misses = 0;
+            while (Position <= Count - MATCH_LIMIT) {
+                const unsigned int Sequence = Read32(Position);
+                const unsigned int Hash = Sequence * 2654435761u >> (32 - HASH_BITS);
+                const size_t Candidate = Table[Hash];
+                Table[Hash] = static_cast<unsigned int>(Position + 1);
+                if (Candidate == 0 || Position - (Candidate - 1) > 0xFFFF || Read32(Candidate - 1) != Sequence) {
+                    // Skip ahead faster through data that does not compress
+                    Position += 1 + (Misses++ >> 6);
+                    continue;
+                }
+                Misses = 0;
+
+                // Extend the match as far as possible without touching the last literals
+                const size_t Match = Candidate - 1;
+                size_t Length = MIN_MATCH;
+                while (Position + Length < Count - LAST_LITERALS && Bytes[Match + Length] == Bytes[Position + Length]) {
+                    ++Length;
+                }
+
+                WriteSequence(Anchor, Position - Anchor, Length, Position - Match);
+                Position += Length;
+                Anchor = Position;
+            }
+        }
+
+        // The block always ends with literals
+        WriteSequence(Anchor, Count - Anchor, 0, 0);
+        return Compressed;
+    }
+
+    // Decompresses the given LZ4 block into exactly the given number of bytes.
+    std::vector<unsigned char> Snapshot::Decompress(const unsigned char *Bytes, const size_t &Count,
+                                                    const size_t &DecompressedCount) {
+        std::vector<unsigned char> Decompressed(DecompressedCount);
+        size_t Input = 0;
+        size_t Output = 0;
+
+        // Reads a length that did not fit in a token
+        const auto ReadLength = [&](size_t Length) {
+            unsigned char Next;
+            do {
+                if (Input >= Count) {
+                    throw std::runtime_error("ERROR: Snapshot data is corrupted!");
+                }
+                Next = Bytes[Input++];
+                Length += Next;
+            } while (Next == 255);
+            return Length;
+        };
+
+        while (Input < Count) {
+            const unsigned char Token = Bytes[Input++];
+
+            // Copy literals
+            size_t LiteralCount = Token >> 4;
+            if (LiteralCount == 15) {
+                LiteralCount = ReadLength(LiteralCount);
+            }
+            if (LiteralCount > Count - Input || LiteralCount > DecompressedCount - Output) {
+                throw std::runtime_error("ERROR: Snapshot data is corrupted!");
+            }
+            if (LiteralCount > 0) {
+                std::memcpy(Decompressed.data() + Output, Bytes + Input, LiteralCount);
+            }
+            Input += LiteralCount;
+            Output += LiteralCount;
+
+            // The last sequence has no match
+            if (Input >= Count) {
+                break;
+            }
+
+            // Copy the match byte by byte since it may overlap itself
+            if (Count - Input < 2) {
+                throw std::runtime_error("ERROR: Snapshot data is corrupted!");
+            }
+            const size_t Offset = Bytes[Input] | static_cast<size_t>(Bytes[Input + 1]) << 8;
+            Input += 2;
+            size_t MatchLength = Token & 15;
+            if (MatchLength == 15) {
+                MatchLength = ReadLength(MatchLength);
+            }
+            MatchLength += MIN_MATCH;
+            if (Offset == 0 || Offset > Output || MatchLength > DecompressedCount - Output) {
+                throw std::runtime_error("ERROR: Snapshot data is corrupted!");
+            }
+            for (size_t i = 0; i < MatchLength; ++i, ++Output) {
+                Decompressed[Output] = Decompressed[Output - Offset];
+            }
+        }
+
+        if (Output != DecompressedCount) {
+            throw std::runtime_error("ERROR: Snapshot data is corrupted!");
+        }
+        return Decompressed;
+    }
+
+    // STATIC VARIABLE INITIALIZATION
+
+    // Each registered actor type in the order they were registered.
+    std::vector<Snapshot::RegisteredActor> Snapshot::ActorTypes;
+
+    // The index of each registered actor type by type.
+    std::unordered_map<std::type_index, int> Snapshot::ActorTypesByType;
+
+    // Each registered component type in the order they were registered.
+    std::vector<Snapshot::RegisteredComponent> Snapshot::ComponentTypes;
+
+    // The index of each registered component type by type.
+    std::unordered_map<std::type_index, int> Snapshot::ComponentTypesByType;
+}
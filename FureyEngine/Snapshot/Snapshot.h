@@ -0,0 +1,278 @@
+// .h
+// World Snapshot Class Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+
+// The version of the snapshot format written by this engine.
+#define SNAPSHOT_VERSION 2
+
+namespace FureyEngine {
+    // Forward declaration of actor.
+    class Actor;
+
+    // Forward declaration of component.
+    class Component;
+
+    // Forward declaration of world.
+    class World;
+
+    /** Appends binary values to the uncompressed contents of a snapshot. */
+    class SnapshotWriter final {
+        // BUFFER
+
+        /** Each byte written so far. */
+        std::vector<unsigned char> Buffer;
+
+        /** Worlds write and compress snapshots. */
+        friend class World;
+
+    public:
+        // WRITING
+
+        /** Writes the given trivially copyable value. */
+        template<typename ValueType>
+        void Write(const ValueType &Value) {
+            static_assert(std::is_trivially_copyable_v<ValueType>,
+                          "Only trivially copyable values can be written to a snapshot!");
+            WriteBytes(&Value, sizeof(ValueType));
+        }
+
+        /** Writes the given string and its length. */
+        void Write(const std::string &Value) {
+            Write(static_cast<unsigned int>(Value.size()));
+            WriteBytes(Value.data(), Value.size());
+        }
+
+        /** Writes the given number of bytes. */
+        void WriteBytes(const void *Bytes, const size_t &Count) {
+            const size_t Offset = Buffer.size();
+            Buffer.resize(Offset + Count);
+            if (Count > 0) {
+                std::memcpy(Buffer.data() + Offset, Bytes, Count);
+            }
+        }
+
+        /** Replaces the trivially copyable value previously written at the given offset. */
+        template<typename ValueType>
+        void Overwrite(const size_t &Offset, const ValueType &Value) {
+            static_assert(std::is_trivially_copyable_v<ValueType>,
+                          "Only trivially copyable values can be written to a snapshot!");
+            if (Offset + sizeof(ValueType) > Buffer.size()) {
+                throw std::runtime_error("ERROR: Cannot overwrite past the end of a snapshot!");
+            }
+            std::memcpy(Buffer.data() + Offset, &Value, sizeof(ValueType));
+        }
+
+        /** Returns the number of bytes written so far, which is the offset of the next value. */
+        [[nodiscard]] size_t Size() const {
+            return Buffer.size();
+        }
+    };
+
+    /** Reads binary values from the uncompressed contents of a snapshot. */
+    class SnapshotReader final {
+        // BUFFER
+
+        /** The bytes being read. */
+        const unsigned char *Data;
+
+        /** The number of bytes being read. */
+        size_t Length;
+
+        /** The offset of the next value to read. */
+        size_t Position = 0;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new reader over the given bytes, which must outlive it. */
+        SnapshotReader(const unsigned char *Data, const size_t &Length) : Data(Data), Length(Length) {
+        }
+
+        // READING
+
+        /** Reads the next trivially copyable value into the given value. */
+        template<typename ValueType>
+        void Read(ValueType &Value) {
+            static_assert(std::is_trivially_copyable_v<ValueType>,
+                          "Only trivially copyable values can be read from a snapshot!");
+            ReadBytes(&Value, sizeof(ValueType));
+        }
+
+        /** Reads the next string into the given string. */
+        void Read(std::string &Value) {
+            const auto Count = Read<unsigned int>();
+            if (Count > Length - Position) {
+                throw std::runtime_error("ERROR: Snapshot ended unexpectedly!");
+            }
+            Value.assign(reinterpret_cast<const char *>(Data + Position), Count);
+            Position += Count;
+        }
+
+        /** Reads and returns the next value of the given type. */
+        template<typename ValueType>
+        ValueType Read() {
+            ValueType Value;
+            Read(Value);
+            return Value;
+        }
+
+        /** Reads the given number of bytes. */
+        void ReadBytes(void *Bytes, const size_t &Count) {
+            if (Count > Length - Position) {
+                throw std::runtime_error("ERROR: Snapshot ended unexpectedly!");
+            }
+            if (Count > 0) {
+                std::memcpy(Bytes, Data + Position, Count);
+            }
+            Position += Count;
+        }
+
+        /** Returns the offset of the next value to read. */
+        [[nodiscard]] size_t Tell() const {
+            return Position;
+        }
+
+        /** Moves to the given offset. */
+        void Seek(const size_t &Offset) {
+            if (Offset > Length) {
+                throw std::runtime_error("ERROR: Cannot seek past the end of a snapshot!");
+            }
+            Position = Offset;
+        }
+    };
+
+    /**
+     * The compressed binary state of a world's actors, components, transforms, time and scheduled events.<br/>
+     * Create one with World->SaveSnapshot() and restore it with World->LoadSnapshot().<br/>
+     * Only actors and components whose types are registered with RegisterActor() and RegisterComponent() are saved.<br/>
+     * NOTE: Scheduled event functions cannot be written to a file, so they are only restored<br/>
+     * from snapshots kept in memory, such as for quick saves and rollback.
+     */
+    class Snapshot final {
+    public:
+        // TYPES
+
+        /** A registered actor type. */
+        struct RegisteredActor final {
+            /** The name this type is saved with. */
+            std::string Name;
+
+            /** Spawns the given number of actors of this type in the given world in a single block of memory. */
+            std::function<std::vector<Actor *>(World *, const int &)> Spawn;
+        };
+
+        /** A registered component type. */
+        struct RegisteredComponent final {
+            /** The name this type is saved with. */
+            std::string Name;
+
+            /** Attaches a new component of this type to the given actor. */
+            std::function<Component *(Actor *)> Attach;
+        };
+
+    private:
+        // DATA
+
+        /** The compressed contents of this snapshot. */
+        std::vector<unsigned char> CompressedBytes;
+
+        /** The size of the contents of this snapshot before it was compressed. */
+        size_t RawSize = 0;
+
+        /** Each scheduled event's function in the order they were saved, which are not written to files. */
+        std::vector<std::function<void()> > Events;
+
+        /** Worlds save and load snapshots. */
+        friend class World;
+
+        // TYPES
+
+        /** Each registered actor type in the order they were registered. */
+        static std::vector<RegisteredActor> ActorTypes;
+
+        /** The index of each registered actor type by type. */
+        static std::unordered_map<std::type_index, int> ActorTypesByType;
+
+        /** Each registered component type in the order they were registered. */
+        static std::vector<RegisteredComponent> ComponentTypes;
+
+        /** The index of each registered component type by type. */
+        static std::unordered_map<std::type_index, int> ComponentTypesByType;
+
+        /** Registers the given actor type, replacing its previous registration if it has one. */
+        static void RegisterActorType(const std::type_index &Type, RegisteredActor Registered);
+
+        /** Registers the given component type, replacing its previous registration if it has one. */
+        static void RegisterComponentType(const std::type_index &Type, RegisteredComponent Registered);
+
+    public:
+        // TYPES
+
+        /**
+         * Registers the given actor type so snapshots save and restore it under the given name.<br/>
+         * Restored actors are constructed with the given arguments, then load their saved state.<br/>
+         * This is defined in World.h once the world class is complete.
+         */
+        template<typename ActorType, typename... ArgumentTypes>
+        static void RegisterActor(const std::string &TypeName, ArgumentTypes... Arguments);
+
+        /**
+         * Registers the given component type so snapshots save and restore it under the given name.<br/>
+         * Restored components are attached with the given function, or default constructed if it is nullptr,<br/>
+         * then load their saved state.<br/>
+         * This is defined in World.h once the world class is complete.
+         */
+        template<typename ComponentType>
+        static void RegisterComponent(const std::string &TypeName,
+                                      const std::function<Component *(Actor *)> &Attach = nullptr);
+
+        /** Returns the registered actor type of the given type, or nullptr if it is not registered. */
+        [[nodiscard]] static const RegisteredActor *FindActorType(const std::type_index &Type);
+
+        /** Returns the registered actor type with the given name, or nullptr if it is not registered. */
+        [[nodiscard]] static const RegisteredActor *FindActorType(const std::string &TypeName);
+
+        /** Returns the registered component type of the given type, or nullptr if it is not registered. */
+        [[nodiscard]] static const RegisteredComponent *FindComponentType(const std::type_index &Type);
+
+        /** Returns the registered component type with the given name, or nullptr if it is not registered. */
+        [[nodiscard]] static const RegisteredComponent *FindComponentType(const std::string &TypeName);
+
+        // DATA
+
+        /** Returns the size in bytes of this snapshot once compressed. */
+        [[nodiscard]] size_t Size() const;
+
+        /** Returns the size in bytes of this snapshot before it was compressed. */
+        [[nodiscard]] size_t UncompressedSize() const;
+
+        /** Returns whether this snapshot contains nothing. */
+        [[nodiscard]] bool IsEmpty() const;
+
+        // FILES
+
+        /**
+         * Writes this snapshot to the given file.<br/>
+         * NOTE: Scheduled event functions are not written.
+         */
+        void SaveToFile(const std::string &Path) const;
+
+        /** Reads a snapshot from the given file. */
+        [[nodiscard]] static Snapshot LoadFromFile(const std::string &Path);
+
+        // COMPRESSION
+
+        /**
+         * Compresses the given bytes into an LZ4 block.<br/>
+         * Repeated sequences are replaced by references to their previous occurrence within the last 64 KB.
+         */
+        [[nodiscard]] static std::vector<unsigned char> Compress(const unsigned char *Bytes, const size_t &Count);
+
+        /** Decompresses the given LZ4 block into exactly the given number of bytes. */
+        [[nodiscard]] static std::vector<unsigned char> Decompress(const unsigned char *Bytes, const size_t &Count,
+                                                                   const size_t &DecompressedCount);
+    };
+}
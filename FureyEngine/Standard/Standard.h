@@ -4,6 +4,26 @@
 
 #pragma once
 
+// BUILD SETTINGS
+
+// Whether the engine runs its worlds without a window, OpenGL context or renderer.
+// Enable this with the HEADLESS CMake option for server side simulation and performance runs.
+#ifndef HEADLESS
+#define HEADLESS 0
+#endif
+
+// Whether profiled zones are compiled into the engine and recorded while the profiler is started.
+// Enable this with the PROFILING CMake option to export Chrome traces of where each frame goes.
+#ifndef PROFILING
+#define PROFILING 0
+#endif
+
+// Whether every allocation is counted by the allocation tracker under the profiled zone it was made in.
+// Enable this with the TRACK_ALLOCATIONS CMake option to report what each frame allocates and where.
+#ifndef TRACK_ALLOCATIONS
+#define TRACK_ALLOCATIONS 0
+#endif
+
 // STANDARD LIBRARY HEADERS
 
 #include <bits/stdc++.h>
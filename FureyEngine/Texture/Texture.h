@@ -30,6 +30,14 @@ namespace FureyEngine {
         /** A pointer to the transform of this texture. */
         Transform *Transform = nullptr;
 
+        // INTERPOLATION
+
+        /** A pointer to the transform of this texture as of the previous fixed simulation step, or nullptr. */
+        const FureyEngine::Transform *PreviousTransform = nullptr;
+
+        /** A pointer to how far between the previous and current transform this texture should be drawn, or nullptr. */
+        const double *Interpolation = nullptr;
+
         // TEXTURE CONSTRUCTOR
 
         /** Constructs a new texture from a texture ID and a transform. */
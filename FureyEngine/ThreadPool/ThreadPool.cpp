@@ -0,0 +1,133 @@
+// .cpp
+// Worker Thread Pool Script
+// by Kyle Furey
+
+#include "ThreadPool.h"
+
+namespace FureyEngine {
+    // WORKERS
+
+    // Claims and runs jobs of the current batch until there are none left.
+    void ThreadPool::RunJobs() {
+        for (int Index = NextJob++; Index < JobCount; Index = NextJob++) {
+            try {
+                (*Job)(Index);
+            } catch (...) {
+                std::lock_guard Lock(Mutex);
+                if (Exception == nullptr) {
+                    Exception = std::current_exception();
+                }
+            }
+        }
+    }
+
+    // The loop each worker thread runs until this pool is destroyed.
+    void ThreadPool::WorkerLoop() {
+        RunningPool = this;
+        unsigned long long LastBatch = 0;
+        while (true) {
+            {
+                std::unique_lock Lock(Mutex);
+                BatchReady.wait(Lock, [&] { return Stopping || Batch != LastBatch; });
+                if (Stopping) {
+                    return;
+                }
+                LastBatch = Batch;
+            }
+
+            RunJobs();
+
+            std::lock_guard Lock(Mutex);
+            if (--BusyWorkers == 0) {
+                BatchComplete.notify_one();
+            }
+        }
+    }
+
+    // CONSTRUCTORS
+
+    // Constructs a new thread pool with the given number of worker threads.
+    // By default this leaves one logical processor for the calling thread.
+    ThreadPool::ThreadPool(int NumberOfWorkers) {
+        if (NumberOfWorkers < 0) {
+            NumberOfWorkers = 0;
+        }
+        Workers.reserve(NumberOfWorkers);
+        for (int i = 0; i < NumberOfWorkers; ++i) {
+            Workers.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    // DESTRUCTOR
+
+    // Stops and joins each worker thread.
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard Lock(Mutex);
+            Stopping = true;
+        }
+        BatchReady.notify_all();
+        for (auto &Worker: Workers) {
+            Worker.join();
+        }
+    }
+
+    // WORKERS
+
+    // Returns the number of worker threads in this pool, not including the submitting thread.
+    int ThreadPool::Count() const {
+        return static_cast<int>(Workers.size());
+    }
+
+    // JOBS
+
+    // Calls the given function once with each index from 0 to the given count across this pool's workers.
+    // This blocks until every call is complete and rethrows the first exception thrown by a call.
+    // Batches submitted from several threads at once run one after another.
+    // Batches submitted from within one of this pool's own jobs run serially on the calling thread.
+    void ThreadPool::ParallelFor(const int &Count, const std::function<void(int)> &Function) {
+        if (Count <= 0) {
+            return;
+        }
+
+        // Run small and nested batches on the calling thread
+        if (Count == 1 || Workers.empty() || RunningPool == this) {
+            for (int i = 0; i < Count; ++i) {
+                Function(i);
+            }
+            return;
+        }
+
+        // Submit the batch
+        std::lock_guard Submit(SubmitMutex);
+        ThreadPool *const PreviousPool = RunningPool;
+        RunningPool = this;
+        {
+            std::lock_guard Lock(Mutex);
+            Job = &Function;
+            JobCount = Count;
+            NextJob = 0;
+            BusyWorkers = static_cast<int>(Workers.size());
+            Exception = nullptr;
+            ++Batch;
+        }
+        BatchReady.notify_all();
+
+        // Help run the batch and wait for each worker to finish
+        RunJobs();
+        std::unique_lock Lock(Mutex);
+        BatchComplete.wait(Lock, [&] { return BusyWorkers == 0; });
+        RunningPool = PreviousPool;
+        Job = nullptr;
+        if (Exception != nullptr) {
+            const auto Thrown = Exception;
+            Exception = nullptr;
+            std::rethrow_exception(Thrown);
+        }
+    }
+
+    // STATIC VARIABLE INITIALIZATION
+
+    // The pool whose jobs the current thread is running, or nullptr if it is not running any jobs.
+    thread_local ThreadPool *ThreadPool::RunningPool = nullptr;
+}
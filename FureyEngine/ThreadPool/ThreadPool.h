@@ -0,0 +1,106 @@
+// .h
+// Worker Thread Pool Script
+// by Kyle Furey
+
+#pragma once
+#include "../Thread/Thread.h"
+
+namespace FureyEngine {
+    /**
+     * Represents a fixed set of persistent worker threads that run batches of jobs in parallel.<br/>
+     * The thread that submits a batch also runs jobs and waits until the whole batch is complete.
+     */
+    class ThreadPool final {
+        // WORKERS
+
+        /** Each worker thread in this pool. */
+        std::vector<std::thread> Workers;
+
+        /** Guards the current batch and wakes sleeping workers. */
+        std::mutex Mutex;
+
+        /** Ensures only one thread submits a batch to this pool at a time. */
+        std::mutex SubmitMutex;
+
+        /** The pool whose jobs the current thread is running, or nullptr if it is not running any jobs. */
+        static thread_local ThreadPool *RunningPool;
+
+        /** Notifies workers that a new batch is ready or that this pool is stopping. */
+        std::condition_variable BatchReady;
+
+        /** Notifies the submitting thread that each worker has finished the current batch. */
+        std::condition_variable BatchComplete;
+
+        /** Whether this pool is being destroyed. */
+        bool Stopping = false;
+
+        // BATCH
+
+        /** The function called with each job index of the current batch. */
+        const std::function<void(int)> *Job = nullptr;
+
+        /** The number of jobs in the current batch. */
+        int JobCount = 0;
+
+        /** The next job index to be claimed in the current batch. */
+        std::atomic<int> NextJob = 0;
+
+        /** The number of workers still running the current batch. */
+        int BusyWorkers = 0;
+
+        /** Incremented each time a new batch is submitted so workers only run each batch once. */
+        unsigned long long Batch = 0;
+
+        /** The first exception thrown by a job in the current batch. */
+        std::exception_ptr Exception = nullptr;
+
+        /** Claims and runs jobs of the current batch until there are none left. */
+        void RunJobs();
+
+        /** The loop each worker thread runs until this pool is destroyed. */
+        void WorkerLoop();
+
+    public:
+        // CONSTRUCTORS
+
+        /**
+         * Constructs a new thread pool with the given number of worker threads.<br/>
+         * By default this leaves one logical processor for the calling thread.
+         */
+        explicit ThreadPool(int NumberOfWorkers = Thread::NumberOfProcessors() - 1);
+
+        /** Delete copy constructor. */
+        ThreadPool(const ThreadPool &Copied) = delete;
+
+        /** Delete move constructor. */
+        ThreadPool(ThreadPool &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        ThreadPool &operator=(const ThreadPool &Copied) = delete;
+
+        /** Delete move constructor. */
+        ThreadPool &operator=(ThreadPool &&Moved) = delete;
+
+        // DESTRUCTOR
+
+        /** Stops and joins each worker thread. */
+        ~ThreadPool();
+
+        // WORKERS
+
+        /** Returns the number of worker threads in this pool, not including the submitting thread. */
+        [[nodiscard]] int Count() const;
+
+        // JOBS
+
+        /**
+         * Calls the given function once with each index from 0 to the given count across this pool's workers.<br/>
+         * This blocks until every call is complete and rethrows the first exception thrown by a call.<br/>
+         * Batches submitted from several threads at once run one after another.<br/>
+         * Batches submitted from within one of this pool's own jobs run serially on the calling thread.
+         */
+        void ParallelFor(const int &Count, const std::function<void(int)> &Function);
+    };
+}
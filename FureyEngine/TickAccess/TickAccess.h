@@ -0,0 +1,64 @@
+// .h
+// Tick Access Declaration Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+
+namespace FureyEngine {
+    /**
+     * Each kind of state a component can read or write while it ticks.<br/>
+     * Access kinds are bit flags and can be combined with the | operator.
+     */
+    enum class TickAccess : unsigned char {
+        /** No state outside of the component itself. */
+        NONE = 0,
+
+        /** The component's owning actor and that actor's other components. */
+        OWNER = 1 << 0,
+
+        /** Any other actor or component in the same world. */
+        WORLD = 1 << 1,
+
+        /** Engine-wide state such as input, controllers, resources, renderers and OpenGL. */
+        ENGINE = 1 << 2,
+
+        /** Every kind of state. */
+        ALL = OWNER | WORLD | ENGINE
+    };
+
+    /** Returns the combination of the given tick access kinds. */
+    inline TickAccess operator|(const TickAccess &Left, const TickAccess &Right) {
+        return static_cast<TickAccess>(static_cast<unsigned char>(Left) | static_cast<unsigned char>(Right));
+    }
+
+    /** Returns the tick access kinds shared by the given tick access kinds. */
+    inline TickAccess operator&(const TickAccess &Left, const TickAccess &Right) {
+        return static_cast<TickAccess>(static_cast<unsigned char>(Left) & static_cast<unsigned char>(Right));
+    }
+
+    /** Returns whether the given tick access kinds include any of the other given tick access kinds. */
+    inline bool HasTickAccess(const TickAccess &Access, const TickAccess &Kinds) {
+        return (Access & Kinds) != TickAccess::NONE;
+    }
+
+    /**
+     * The state a component declares it reads and writes while it ticks.<br/>
+     * Worlds use this to decide which components can tick at the same time on worker threads.
+     */
+    struct TickDependencies final {
+        /** Each kind of state read while ticking. */
+        TickAccess Reads = TickAccess::ALL;
+
+        /** Each kind of state written while ticking. */
+        TickAccess Writes = TickAccess::ALL;
+
+        /**
+         * Returns whether a component with these dependencies may tick on a worker thread.<br/>
+         * Only components that write nothing outside of their owning actor may.
+         */
+        [[nodiscard]] bool IsParallel() const {
+            return !HasTickAccess(Writes, TickAccess::WORLD | TickAccess::ENGINE);
+        }
+    };
+}
@@ -0,0 +1,54 @@
+// .h
+// Tick Phase Flags Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+
+#define TICK_PHASE_COUNT 4
+
+namespace FureyEngine {
+    /**
+     * Each phase of a world update that an actor or component can be registered to tick in.<br/>
+     * Phases are bit flags and can be combined with the | operator.
+     */
+    enum class TickPhase : unsigned char {
+        /** The object never ticks once it has started. */
+        NONE = 0,
+
+        /** The object's Tick() and OnTick events are called each world tick. */
+        TICK = 1 << 0,
+
+        /** The object's LateTick() and OnLateTick events are called each world tick. */
+        LATE_TICK = 1 << 1,
+
+        /** The object's Tick() and OnTick events are called each fixed simulation step of its world. */
+        FIXED_TICK = 1 << 2,
+
+        /** The object's LateTick() and OnLateTick events are called each fixed simulation step of its world. */
+        FIXED_LATE_TICK = 1 << 3,
+
+        /** The object ticks in every variable phase, once per world tick. */
+        ALL = TICK | LATE_TICK
+    };
+
+    /** Returns the combination of the given tick phases. */
+    inline TickPhase operator|(const TickPhase &Left, const TickPhase &Right) {
+        return static_cast<TickPhase>(static_cast<unsigned char>(Left) | static_cast<unsigned char>(Right));
+    }
+
+    /** Returns the tick phases shared by the given tick phases. */
+    inline TickPhase operator&(const TickPhase &Left, const TickPhase &Right) {
+        return static_cast<TickPhase>(static_cast<unsigned char>(Left) & static_cast<unsigned char>(Right));
+    }
+
+    /** Returns whether the given tick phases include the given tick phase. */
+    inline bool HasTickPhase(const TickPhase &Phases, const TickPhase &Phase) {
+        return (Phases & Phase) != TickPhase::NONE;
+    }
+
+    /** Returns the fixed simulation step equivalent of the given variable tick phases. */
+    inline TickPhase ToFixedTickPhase(const TickPhase &Phases) {
+        return static_cast<TickPhase>(static_cast<unsigned char>(Phases & TickPhase::ALL) << 2);
+    }
+}
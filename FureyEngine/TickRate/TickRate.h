@@ -0,0 +1,109 @@
+// .h
+// Tick Rate Declaration Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+
+namespace FureyEngine {
+    /** How relevant an actor currently is to what the player can see. */
+    enum class TickRelevance : unsigned char {
+        /** The actor is in view and ticks at its full tick rate. */
+        VISIBLE = 0,
+
+        /** The actor is out of view but close enough to tick at a reduced rate. */
+        NEARBY = 1,
+
+        /** The actor is far away and ticks at its lowest rate, if at all. */
+        DISTANT = 2
+    };
+
+    /**
+     * How often an actor or component ticks in the variable tick phases, and how that changes with its relevance.<br/>
+     * Throttled objects receive the total delta time since their last tick, so time is never lost between ticks.<br/>
+     * Fixed simulation steps are never throttled.
+     */
+    struct TickRate final {
+        /** The number of world ticks between each tick, or 1 to tick every world tick. */
+        int Interval = 1;
+
+        /** The number of seconds between each tick, which is used instead of the interval if greater than 0. */
+        double Seconds = 0;
+
+        /** How many times longer to wait between ticks while nearby, or 0 to not tick at all. */
+        int NearbyMultiplier = 1;
+
+        /** How many times longer to wait between ticks while distant, or 0 to not tick at all. */
+        int DistantMultiplier = 1;
+
+        /** Returns whether this rate ticks every world tick regardless of relevance. */
+        [[nodiscard]] bool IsEveryTick() const {
+            return Interval <= 1 && Seconds <= 0 && NearbyMultiplier == 1 && DistantMultiplier == 1;
+        }
+
+        /** Returns whether this rate changes with relevance. */
+        [[nodiscard]] bool IsRelevant() const {
+            return NearbyMultiplier != 1 || DistantMultiplier != 1;
+        }
+
+        /** Returns how many times longer to wait between ticks at the given relevance. */
+        [[nodiscard]] int Multiplier(const TickRelevance &Relevance) const {
+            switch (Relevance) {
+                case TickRelevance::NEARBY:
+                    return NearbyMultiplier;
+                case TickRelevance::DISTANT:
+                    return DistantMultiplier;
+                default:
+                    return 1;
+            }
+        }
+    };
+
+    /** The tick rate of a registered actor or component and its progress toward its next tick in each variable phase. */
+    struct TickThrottle final {
+        /** The tick rate this object was registered with. */
+        TickRate Rate;
+
+        /** The delta time accumulated since the last tick in each variable phase. */
+        double SkippedTime[2] = {0, 0};
+
+        /** The number of world ticks since the last tick in each variable phase. */
+        int SkippedTicks[2] = {0, 0};
+
+        /**
+         * Resets this throttle to the given rate, offsetting its first tick by the given value<br/>
+         * so objects registered on the same world tick do not all tick together.
+         */
+        void Reset(const TickRate &NewRate, const unsigned int &Offset) {
+            Rate = NewRate;
+            for (int i = 0; i < 2; ++i) {
+                SkippedTime[i] = 0;
+                SkippedTicks[i] = Rate.Seconds <= 0 && Rate.Interval > 1 ? static_cast<int>(Offset % Rate.Interval) : 0;
+            }
+        }
+
+        /**
+         * Accumulates the given delta time for the given variable phase and returns whether the object should tick.<br/>
+         * When it should, the delta time to tick with is written to the given output and the phase is reset.<br/>
+         * A multiplier of 0 discards the accumulated time, so dormant objects do not catch up on time they missed.
+         */
+        bool Consume(const int &Phase, const double &DeltaTime, const int &Multiplier, double &TickDeltaTime) {
+            if (Multiplier <= 0) {
+                SkippedTime[Phase] = 0;
+                SkippedTicks[Phase] = 0;
+                return false;
+            }
+            SkippedTime[Phase] += DeltaTime;
+            ++SkippedTicks[Phase];
+            if (Rate.Seconds > 0
+                    ? SkippedTime[Phase] < Rate.Seconds * Multiplier
+                    : SkippedTicks[Phase] < std::max(Rate.Interval, 1) * Multiplier) {
+                return false;
+            }
+            TickDeltaTime = SkippedTime[Phase];
+            SkippedTime[Phase] = 0;
+            SkippedTicks[Phase] = 0;
+            return true;
+        }
+    };
+}
@@ -0,0 +1,380 @@
+// .cpp
+// Hierarchical Timing Wheel Script
+// by Kyle Furey
+
+#include "TimerWheel.h"
+
+namespace FureyEngine {
+    // TIMERS
+
+    // Returns the tick the given time falls in.
+    unsigned long long TimerWheel::TickOf(const double &Time) {
+        return Time > 0 ? static_cast<unsigned long long>(Time / TIMER_WHEEL_RESOLUTION) : 0;
+    }
+
+    // Adds the given timer to the slot of the tick it is due.
+    void TimerWheel::Insert(const int &Index) {
+        Timer &Inserted = Timers[Index];
+        const unsigned long long Tick = TickOf(Inserted.DueTime);
+
+        // Find the lowest level whose range reaches the due tick
+        int Slot = READY_SLOT;
+        if (Tick > CurrentTick) {
+            const unsigned long long Distance = Tick - CurrentTick;
+            int Level = 0;
+            while (Level < TIMER_WHEEL_LEVELS - 1 && Distance >= 1ULL << (TIMER_WHEEL_BITS * (Level + 1))) {
+                ++Level;
+            }
+
+            // Timers beyond the last level wait in its furthest slot and are placed again when it comes up
+            const unsigned long long Reached = std::min(
+                Tick, CurrentTick + (1ULL << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1);
+            Slot = Level * SLOTS + static_cast<int>((Reached >> (TIMER_WHEEL_BITS * Level)) & (SLOTS - 1));
+            ++Waiting;
+        }
+
+        Inserted.State = TimerState::SCHEDULED;
+        Inserted.Slot = Slot;
+        Inserted.Previous = -1;
+        Inserted.Next = Slots[Slot];
+        if (Slots[Slot] != -1) {
+            Timers[Slots[Slot]].Previous = Index;
+        }
+        Slots[Slot] = Index;
+    }
+
+    // Removes the given timer from its slot.
+    void TimerWheel::Unlink(const int &Index) {
+        Timer &Unlinked = Timers[Index];
+        if (Unlinked.Previous != -1) {
+            Timers[Unlinked.Previous].Next = Unlinked.Next;
+        } else {
+            Slots[Unlinked.Slot] = Unlinked.Next;
+        }
+        if (Unlinked.Next != -1) {
+            Timers[Unlinked.Next].Previous = Unlinked.Previous;
+        }
+        if (Unlinked.Slot != READY_SLOT) {
+            --Waiting;
+        }
+        Unlinked.Slot = -1;
+        Unlinked.Previous = -1;
+        Unlinked.Next = -1;
+    }
+
+    // Moves each timer in the given slot to a lower level for the current tick.
+    void TimerWheel::Cascade(const int &Slot) {
+        int Index = Slots[Slot];
+        Slots[Slot] = -1;
+        while (Index != -1) {
+            const int Next = Timers[Index].Next;
+            --Waiting;
+            Insert(Index);
+            Index = Next;
+        }
+    }
+
+    // Moves each timer in the given slot to the timers being invoked.
+    void TimerWheel::Collect(const int &Slot) {
+        int Index = Slots[Slot];
+        Slots[Slot] = -1;
+        while (Index != -1) {
+            Timer &Collected = Timers[Index];
+            const int Next = Collected.Next;
+            if (Slot != READY_SLOT) {
+                --Waiting;
+            }
+            Collected.Slot = -1;
+            Collected.Previous = -1;
+            Collected.Next = -1;
+            Collected.State = TimerState::FIRING;
+            Firing.emplace_back(Index, Collected.Generation);
+            Index = Next;
+        }
+    }
+
+    // Returns a new timer for the given function that is not scheduled yet.
+    int TimerWheel::Allocate(std::function<void()> Function) {
+        int Index;
+        if (FirstFree != -1) {
+            Index = FirstFree;
+            FirstFree = Timers[Index].Next;
+        } else {
+            Index = static_cast<int>(Timers.size());
+            Timers.emplace_back();
+        }
+        Timers[Index].Function = std::move(Function);
+        Timers[Index].Next = -1;
+        ++Active;
+        return Index;
+    }
+
+    // Frees the given timer, invalidating each of its handles.
+    void TimerWheel::Free(const int &Index) {
+        Timer &Freed = Timers[Index];
+        Freed.Function = nullptr;
+        Freed.State = TimerState::FREE;
+        if (++Freed.Generation == 0) {
+            Freed.Generation = 1;
+        }
+        Freed.Slot = -1;
+        Freed.Previous = -1;
+        Freed.Next = FirstFree;
+        FirstFree = Index;
+    }
+
+    // Returns the index of the timer of the given handle if it has not been cancelled or finished, or -1.
+    int TimerWheel::Find(const TimerHandle &Handle) const {
+        if (Handle.Generation == 0 || Handle.Index >= Timers.size()) {
+            return -1;
+        }
+        const Timer &Found = Timers[Handle.Index];
+        return Found.Generation == Handle.Generation && Found.State != TimerState::FREE
+                   ? static_cast<int>(Handle.Index)
+                   : -1;
+    }
+
+    // CONSTRUCTORS
+
+    // Constructs a new empty timing wheel.
+    TimerWheel::TimerWheel() {
+        std::fill(std::begin(Slots), std::end(Slots), -1);
+    }
+
+    // SCHEDULE
+
+    // Schedules the given function to be invoked after the given number of seconds.
+    // It then repeats every period seconds until it has been invoked the given number of loops.
+    // If loops is equal to -1, it will repeat forever.
+    // Returns a handle that cancels the function when passed to Cancel().
+    TimerHandle TimerWheel::Schedule(double Delay, double Period, const int &Loops, std::function<void()> Function) {
+        if (Function == nullptr) {
+            throw std::runtime_error("ERROR: Attempted to schedule an invalid function!");
+        }
+        if (Loops == 0) {
+            return {};
+        }
+        const int Index = Allocate(std::move(Function));
+        Timer &Scheduled = Timers[Index];
+        Scheduled.DueTime = Now + std::max(Delay, 0.0);
+        Scheduled.Period = std::max(Period, 0.0);
+        Scheduled.Loops = Loops;
+        Scheduled.Sequence = NextSequence++;
+        Insert(Index);
+        return {static_cast<unsigned int>(Index), Scheduled.Generation};
+    }
+
+    // Cancels the scheduled function with the given handle.
+    // Returns whether the function was still scheduled.
+    bool TimerWheel::Cancel(const TimerHandle &Handle) {
+        const int Index = Find(Handle);
+        if (Index == -1) {
+            return false;
+        }
+        --Active;
+
+        // Firing timers are freed once their function returns
+        if (Timers[Index].State == TimerState::FIRING) {
+            if (++Timers[Index].Generation == 0) {
+                Timers[Index].Generation = 1;
+            }
+        } else {
+            Unlink(Index);
+            Free(Index);
+        }
+        return true;
+    }
+
+    // Returns whether the function with the given handle is still scheduled.
+    bool TimerWheel::IsScheduled(const TimerHandle &Handle) const {
+        return Find(Handle) != -1;
+    }
+
+    // Returns the number of seconds until the function with the given handle is next invoked, or -1 if it is not scheduled.
+    double TimerWheel::RemainingTime(const TimerHandle &Handle) const {
+        const int Index = Find(Handle);
+        return Index != -1 ? std::max(Timers[Index].DueTime - Now, 0.0) : -1;
+    }
+
+    // ADVANCE
+
+    // Advances this wheel by the given number of seconds and invokes each function that is now due.
+    // Functions scheduled while invoking are first invoked by the next advance.
+    void TimerWheel::Advance(const double &DeltaTime) {
+        if (!Firing.empty()) {
+            return;
+        }
+        PROFILE_ZONE("TimerWheel::Advance");
+        Now += std::max(DeltaTime, 0.0);
+
+        // Empty each slot up to the current tick, moving higher levels down as their slots come up
+        const unsigned long long TargetTick = TickOf(Now);
+        while (CurrentTick < TargetTick) {
+            if (Waiting == 0) {
+                CurrentTick = TargetTick;
+                break;
+            }
+            ++CurrentTick;
+            for (int Level = TIMER_WHEEL_LEVELS - 1; Level > 0; --Level) {
+                if ((CurrentTick & ((1ULL << (TIMER_WHEEL_BITS * Level)) - 1)) == 0) {
+                    Cascade(Level * SLOTS + static_cast<int>(
+                                (CurrentTick >> (TIMER_WHEEL_BITS * Level)) & (SLOTS - 1)));
+                }
+            }
+            Collect(static_cast<int>(CurrentTick & (SLOTS - 1)));
+        }
+        Collect(READY_SLOT);
+        if (Firing.empty()) {
+            return;
+        }
+
+        // Timers due later within the current tick wait for the next advance
+        Firing.erase(std::remove_if(Firing.begin(), Firing.end(), [this](const std::pair<int, unsigned int> &Entry) {
+            if (Timers[Entry.first].DueTime > Now) {
+                Insert(Entry.first);
+                return true;
+            }
+            return false;
+        }), Firing.end());
+
+        // Invoke each due timer in the order they are due, then in the order they were scheduled
+        std::sort(Firing.begin(), Firing.end(), [this](const std::pair<int, unsigned int> &Left,
+                                                       const std::pair<int, unsigned int> &Right) {
+            const Timer &LeftTimer = Timers[Left.first];
+            const Timer &RightTimer = Timers[Right.first];
+            return LeftTimer.DueTime != RightTimer.DueTime
+                       ? LeftTimer.DueTime < RightTimer.DueTime
+                       : LeftTimer.Sequence < RightTimer.Sequence;
+        });
+        struct FiringScope final {
+            TimerWheel &Wheel;
+
+            ~FiringScope() {
+                // Free timers left behind if a function threw
+                for (const auto &[Index, Generation]: Wheel.Firing) {
+                    if (Wheel.Timers[Index].State == TimerState::FIRING) {
+                        if (Wheel.Timers[Index].Generation == Generation) {
+                            --Wheel.Active;
+                        }
+                        Wheel.Free(Index);
+                    }
+                }
+                Wheel.Firing.clear();
+            }
+        } Scope{*this};
+        for (auto &[Index, Generation]: Firing) {
+            Timer &Fired = Timers[Index];
+            if (Fired.Generation == Generation) {
+                Fired.Function();
+            }
+
+            // Cancelled and finished timers are freed, and repeating timers are scheduled again
+            if (Fired.Generation != Generation || (Fired.Loops > 0 && --Fired.Loops == 0)) {
+                if (Fired.Generation == Generation) {
+                    --Active;
+                }
+                Free(Index);
+            } else if (Fired.Period > 0) {
+                Fired.DueTime += Fired.Period;
+                if (Fired.DueTime <= Now) {
+                    Fired.DueTime += Fired.Period * std::ceil((Now - Fired.DueTime) / Fired.Period);
+                }
+                Insert(Index);
+            } else {
+                Fired.DueTime = Now;
+                Insert(Index);
+            }
+        }
+    }
+
+    // Returns the total number of seconds this wheel has advanced.
+    double TimerWheel::Time() const {
+        return Now;
+    }
+
+    // COUNT
+
+    // Returns the number of scheduled functions.
+    int TimerWheel::Count() const {
+        return Active;
+    }
+
+    // CLEAR
+
+    // Cancels every scheduled function.
+    void TimerWheel::Clear() {
+        for (size_t i = 0; i < Timers.size(); ++i) {
+            if (Timers[i].State == TimerState::SCHEDULED) {
+                Unlink(static_cast<int>(i));
+                Free(static_cast<int>(i));
+            } else if (Timers[i].State == TimerState::FIRING && ++Timers[i].Generation == 0) {
+                Timers[i].Generation = 1;
+            }
+        }
+        Active = 0;
+    }
+
+    // SNAPSHOTS
+
+    // Writes this wheel's time and the timing of each scheduled function.
+    // Each function is added to the given functions instead, since functions cannot be written.
+    void TimerWheel::Save(SnapshotWriter &Writer, std::vector<std::function<void()> > &Functions) const {
+        Writer.Write(Now);
+        Writer.Write(CurrentTick);
+        Writer.Write(NextSequence);
+        Writer.Write(static_cast<unsigned int>(Timers.size()));
+        for (const auto &Saved: Timers) {
+            Writer.Write(Saved.Generation);
+            const bool Scheduled = Saved.State == TimerState::SCHEDULED;
+            Writer.Write(Scheduled);
+            if (Scheduled) {
+                Writer.Write(Saved.DueTime);
+                Writer.Write(Saved.Period);
+                Writer.Write(Saved.Loops);
+                Writer.Write(Saved.Sequence);
+                Functions.push_back(Saved.Function);
+            }
+        }
+    }
+
+    // Reads this wheel's time and reschedules each saved function with its original handle.
+    // Functions beyond the given functions are not rescheduled.
+    void TimerWheel::Load(SnapshotReader &Reader, const std::vector<std::function<void()> > &Functions) {
+        Timers.clear();
+        std::fill(std::begin(Slots), std::end(Slots), -1);
+        FirstFree = -1;
+        Waiting = 0;
+        Active = 0;
+        Reader.Read(Now);
+        Reader.Read(CurrentTick);
+        Reader.Read(NextSequence);
+
+        // Restore each timer at its original index and generation so existing handles stay valid
+        const auto TimerCount = Reader.Read<unsigned int>();
+        Timers.resize(TimerCount);
+        size_t Function = 0;
+        for (unsigned int i = 0; i < TimerCount; ++i) {
+            Timer &Loaded = Timers[i];
+            Reader.Read(Loaded.Generation);
+            if (Reader.Read<bool>()) {
+                Reader.Read(Loaded.DueTime);
+                Reader.Read(Loaded.Period);
+                Reader.Read(Loaded.Loops);
+                Reader.Read(Loaded.Sequence);
+                if (Function < Functions.size()) {
+                    Loaded.Function = Functions[Function++];
+                    ++Active;
+                    Insert(static_cast<int>(i));
+                }
+            }
+        }
+
+        // Link each unscheduled timer for reuse
+        for (int i = static_cast<int>(TimerCount) - 1; i >= 0; --i) {
+            if (Timers[i].State == TimerState::FREE) {
+                Timers[i].Next = FirstFree;
+                FirstFree = i;
+            }
+        }
+    }
+}
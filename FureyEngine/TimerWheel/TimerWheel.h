@@ -0,0 +1,218 @@
+// .h
+// Hierarchical Timing Wheel Script
+// by Kyle Furey
+
+#pragma once
+#include "../Standard/Standard.h"
+#include "../Profiler/Profiler.h"
+#include "../Snapshot/Snapshot.h"
+
+// The number of seconds in each tick of a timing wheel.
+#define TIMER_WHEEL_RESOLUTION 0.001
+
+// The number of bits of a tick used to index each level of a timing wheel.
+#define TIMER_WHEEL_BITS 8
+
+// The number of levels of a timing wheel, which together span 2^(bits * levels) ticks.
+#define TIMER_WHEEL_LEVELS 4
+
+namespace FureyEngine {
+    /** Identifies a timer scheduled in a timing wheel so it can be cancelled later. */
+    struct TimerHandle final {
+        /** The index of the timer in its timing wheel. */
+        unsigned int Index = 0;
+
+        /** The generation of the timer when it was scheduled, or 0 if this handle is null. */
+        unsigned int Generation = 0;
+    };
+
+    /**
+     * Schedules functions to be invoked after a delay, optionally repeating.<br/>
+     * Timers are sorted into slots by the tick they are due, with each level of slots spanning a larger range of ticks.<br/>
+     * Timers in a higher level are only moved to a lower level once their slot comes up,<br/>
+     * so scheduling, cancelling and firing a timer are each O(1) amortized regardless of how many timers exist.<br/>
+     * Timers due in the same advance are invoked in the order they are due, then in the order they were scheduled.
+     */
+    class TimerWheel final {
+        // TIMERS
+
+        /** The state of a timer. */
+        enum class TimerState : unsigned char {
+            /** The timer is not scheduled and may be reused. */
+            FREE,
+
+            /** The timer is waiting in a slot. */
+            SCHEDULED,
+
+            /** The timer is being invoked. */
+            FIRING
+        };
+
+        /** A scheduled function. */
+        struct Timer final {
+            /** The function to invoke. */
+            std::function<void()> Function = nullptr;
+
+            /** The time this timer is due. */
+            double DueTime = 0;
+
+            /** The number of seconds between each invocation, or 0 to invoke it each advance. */
+            double Period = 0;
+
+            /** The number of invocations remaining, or -1 to repeat forever. */
+            int Loops = 1;
+
+            /** The order this timer was scheduled, used to invoke timers due at the same time in order. */
+            unsigned long long Sequence = 0;
+
+            /** The current generation of this timer, which is incremented each time it is freed. */
+            unsigned int Generation = 1;
+
+            /** The state of this timer. */
+            TimerState State = TimerState::FREE;
+
+            /** The slot this timer is in. */
+            int Slot = -1;
+
+            /** The previous timer in this timer's slot, or -1. */
+            int Previous = -1;
+
+            /** The next timer in this timer's slot, or the next free timer, or -1. */
+            int Next = -1;
+        };
+
+        /** The number of slots in each level. */
+        static constexpr int SLOTS = 1 << TIMER_WHEEL_BITS;
+
+        /** The slot of timers due at or before the current tick. */
+        static constexpr int READY_SLOT = SLOTS * TIMER_WHEEL_LEVELS;
+
+        /** Each timer, which never move in memory so they can be invoked while new timers are scheduled. */
+        std::deque<Timer> Timers;
+
+        /** The first free timer, or -1. */
+        int FirstFree = -1;
+
+        /** The first timer in each slot of each level, followed by the first ready timer, or -1. */
+        int Slots[READY_SLOT + 1];
+
+        /** The last tick whose slot has been emptied. */
+        unsigned long long CurrentTick = 0;
+
+        /** The total seconds this wheel has advanced. */
+        double Now = 0;
+
+        /** The order of the next scheduled timer. */
+        unsigned long long NextSequence = 0;
+
+        /** The number of scheduled timers that are not ready. */
+        int Waiting = 0;
+
+        /** The number of scheduled and firing timers that have not been cancelled. */
+        int Active = 0;
+
+        /** Each timer being invoked by the current advance and its generation. */
+        std::vector<std::pair<int, unsigned int> > Firing;
+
+        /** Returns the tick the given time falls in. */
+        [[nodiscard]] static unsigned long long TickOf(const double &Time);
+
+        /** Adds the given timer to the slot of the tick it is due. */
+        void Insert(const int &Index);
+
+        /** Removes the given timer from its slot. */
+        void Unlink(const int &Index);
+
+        /** Moves each timer in the given slot to a lower level for the current tick. */
+        void Cascade(const int &Slot);
+
+        /** Moves each timer in the given slot to the timers being invoked. */
+        void Collect(const int &Slot);
+
+        /** Returns a new timer for the given function that is not scheduled yet. */
+        int Allocate(std::function<void()> Function);
+
+        /** Frees the given timer, invalidating each of its handles. */
+        void Free(const int &Index);
+
+        /** Returns the index of the timer of the given handle if it has not been cancelled or finished, or -1. */
+        [[nodiscard]] int Find(const TimerHandle &Handle) const;
+
+    public:
+        // CONSTRUCTORS
+
+        /** Constructs a new empty timing wheel. */
+        TimerWheel();
+
+        /** Delete copy constructor. */
+        TimerWheel(const TimerWheel &Copied) = delete;
+
+        /** Delete move constructor. */
+        TimerWheel(TimerWheel &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        TimerWheel &operator=(const TimerWheel &Copied) = delete;
+
+        /** Delete move constructor. */
+        TimerWheel &operator=(TimerWheel &&Moved) = delete;
+
+        // SCHEDULE
+
+        /**
+         * Schedules the given function to be invoked after the given number of seconds.<br/>
+         * It then repeats every period seconds until it has been invoked the given number of loops.<br/>
+         * If loops is equal to -1, it will repeat forever.<br/>
+         * Returns a handle that cancels the function when passed to Cancel().
+         */
+        TimerHandle Schedule(double Delay, double Period, const int &Loops, std::function<void()> Function);
+
+        /**
+         * Cancels the scheduled function with the given handle.<br/>
+         * Returns whether the function was still scheduled.
+         */
+        bool Cancel(const TimerHandle &Handle);
+
+        /** Returns whether the function with the given handle is still scheduled. */
+        [[nodiscard]] bool IsScheduled(const TimerHandle &Handle) const;
+
+        /** Returns the number of seconds until the function with the given handle is next invoked, or -1 if it is not scheduled. */
+        [[nodiscard]] double RemainingTime(const TimerHandle &Handle) const;
+
+        // ADVANCE
+
+        /**
+         * Advances this wheel by the given number of seconds and invokes each function that is now due.<br/>
+         * Functions scheduled while invoking are first invoked by the next advance.
+         */
+        void Advance(const double &DeltaTime);
+
+        /** Returns the total number of seconds this wheel has advanced. */
+        [[nodiscard]] double Time() const;
+
+        // COUNT
+
+        /** Returns the number of scheduled functions. */
+        [[nodiscard]] int Count() const;
+
+        // CLEAR
+
+        /** Cancels every scheduled function. */
+        void Clear();
+
+        // SNAPSHOTS
+
+        /**
+         * Writes this wheel's time and the timing of each scheduled function.<br/>
+         * Each function is added to the given functions instead, since functions cannot be written.
+         */
+        void Save(SnapshotWriter &Writer, std::vector<std::function<void()> > &Functions) const;
+
+        /**
+         * Reads this wheel's time and reschedules each saved function with its original handle.<br/>
+         * Functions beyond the given functions are not rescheduled.
+         */
+        void Load(SnapshotReader &Reader, const std::vector<std::function<void()> > &Functions);
+    };
+}
@@ -131,4 +131,23 @@ namespace FureyEngine {
 
         return RelativeTransform;
     }
+
+    // INTERPOLATION
+
+    // Returns the transform the given amount of the way from the first given transform to the second.
+    // Rotation is interpolated along the shortest direction.
+    Transform Transform::Interpolate(const Transform &From, const Transform &To, const float &Alpha) {
+        float Turn = std::fmod(To.Rotation - From.Rotation, 360.0f);
+        if (Turn > 180) {
+            Turn -= 360;
+        } else if (Turn < -180) {
+            Turn += 360;
+        }
+        return Transform(
+            {From.Position.x + (To.Position.x - From.Position.x) * Alpha,
+             From.Position.y + (To.Position.y - From.Position.y) * Alpha},
+            From.Rotation + Turn * Alpha,
+            {From.Scale.x + (To.Scale.x - From.Scale.x) * Alpha, From.Scale.y + (To.Scale.y - From.Scale.y) * Alpha}
+        );
+    }
 }
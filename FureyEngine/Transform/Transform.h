@@ -60,5 +60,13 @@ namespace FureyEngine {
 
         /** Returns a world transform of the given relative transform relative to the given parent transform. */
         [[nodiscard]] static Transform RelativeToWorld(Transform RelativeTransform, const Transform &ParentTransform);
+
+        // INTERPOLATION
+
+        /**
+         * Returns the transform the given amount of the way from the first given transform to the second.<br/>
+         * Rotation is interpolated along the shortest direction.
+         */
+        [[nodiscard]] static Transform Interpolate(const Transform &From, const Transform &To, const float &Alpha);
     };
 }
@@ -0,0 +1,226 @@
+// .cpp
+// World Partition Class Script
+// by Kyle Furey
+
+#include "WorldPartition.h"
+
+namespace FureyEngine {
+    // CELLS
+
+    // Returns the given cell coordinates packed into a single key.
+    long long WorldPartition::Pack(const CellCoordinate &Coordinate) {
+        return static_cast<long long>(static_cast<unsigned long long>(static_cast<unsigned int>(Coordinate.X)) << 32 |
+                                      static_cast<unsigned int>(Coordinate.Y));
+    }
+
+    // Returns the given packed key as cell coordinates.
+    CellCoordinate WorldPartition::Unpack(const long long &Key) {
+        return {
+            static_cast<int>(static_cast<unsigned long long>(Key) >> 32),
+            static_cast<int>(static_cast<unsigned int>(Key))
+        };
+    }
+
+    // Returns the number of cells between the given cells along whichever axis is furthest.
+    int WorldPartition::Distance(const CellCoordinate &From, const CellCoordinate &To) {
+        return std::max(std::abs(From.X - To.X), std::abs(From.Y - To.Y));
+    }
+
+    // Starts prefetching the given unloaded cell on a background thread if it has not started yet.
+    void WorldPartition::PrefetchCell(Cell &Prefetched) {
+        if (Prefetched.Loaded || Prefetched.Prefetch.valid() || Prefetched.Prefetchers.empty()) {
+            return;
+        }
+        Prefetched.Prefetch = std::async(std::launch::async, [Prefetchers = Prefetched.Prefetchers] {
+            for (const auto &Prefetcher: Prefetchers) {
+                Prefetcher();
+            }
+        });
+    }
+
+    // Waits for the given cell's prefetch, then resolves its assets and spawns its actors.
+    void WorldPartition::LoadCell(Cell &LoadedCell) {
+        if (LoadedCell.Loaded) {
+            return;
+        }
+        const auto SpawningWorld = MyWorld.Get();
+        if (SpawningWorld == nullptr) {
+            return;
+        }
+
+        // Finish prefetching on this thread if the background thread has not yet, rethrowing anything it threw
+        PrefetchCell(LoadedCell);
+        if (LoadedCell.Prefetch.valid()) {
+            LoadedCell.Prefetch.get();
+        }
+
+        // Resolve assets
+        for (const auto &Loader: LoadedCell.Loaders) {
+            Loader();
+        }
+
+        // Spawn actors
+        LoadedCell.Spawned.clear();
+        LoadedCell.Spawned.reserve(LoadedCell.Spawners.size());
+        for (const auto &Spawner: LoadedCell.Spawners) {
+            LoadedCell.Spawned.push_back(Spawner(SpawningWorld));
+        }
+        LoadedCell.Loaded = true;
+    }
+
+    // Destroys the given cell's actors, then frees its assets.
+    void WorldPartition::UnloadCell(Cell &UnloadedCell) {
+        if (!UnloadedCell.Loaded) {
+            return;
+        }
+
+        // Destroy actors
+        if (const auto SpawningWorld = MyWorld.Get()) {
+            for (const auto &Actor: UnloadedCell.Spawned) {
+                if (Actor) {
+                    SpawningWorld->DestroyActor(Actor.Get());
+                }
+            }
+        }
+        UnloadedCell.Spawned.clear();
+
+        // Free assets so they are prefetched again before the next load
+        for (const auto &Unloader: UnloadedCell.Unloaders) {
+            Unloader();
+        }
+        UnloadedCell.Prefetch = {};
+        UnloadedCell.Loaded = false;
+    }
+
+    // CONSTRUCTORS
+
+    // Constructs a new empty world partition for the given world with cells of the given size.
+    WorldPartition::WorldPartition(const Reference<World> &PartitionedWorld, const float &CellSize)
+        : MyWorld(PartitionedWorld), CellSize(CellSize > 0 ? CellSize : 1) {
+    }
+
+    // CELLS
+
+    // Returns the width and height of each cell in world space.
+    float WorldPartition::GetCellSize() const {
+        return CellSize;
+    }
+
+    // Returns the coordinates of the cell containing the given world position.
+    CellCoordinate WorldPartition::GetCell(const glm::vec2 &WorldPosition) const {
+        return {
+            static_cast<int>(std::floor(WorldPosition.x / CellSize)),
+            static_cast<int>(std::floor(WorldPosition.y / CellSize))
+        };
+    }
+
+    // Returns whether the given cell's actors are currently spawned.
+    bool WorldPartition::IsLoaded(const CellCoordinate &Coordinate) const {
+        const auto Found = Cells.find(Pack(Coordinate));
+        return Found != Cells.end() && Found->second.Loaded;
+    }
+
+    // Returns the number of cells whose actors are currently spawned.
+    int WorldPartition::LoadedCount() const {
+        int Count = 0;
+        for (const auto Key: ActiveCells) {
+            if (Cells.at(Key).Loaded) {
+                ++Count;
+            }
+        }
+        return Count;
+    }
+
+    // Adds a function that spawns one of the given cell's actors each time it loads.
+    // The actor is spawned immediately if the cell is already loaded.
+    void WorldPartition::AddSpawner(const CellCoordinate &Coordinate,
+                                    const std::function<Reference<Actor>(World *)> &Spawner) {
+        auto &Added = Cells[Pack(Coordinate)];
+        Added.Spawners.push_back(Spawner);
+        Dirty = true;
+
+        // Spawn the actor now rather than on the cell's next load
+        if (Added.Loaded) {
+            if (const auto SpawningWorld = MyWorld.Get()) {
+                Added.Spawned.push_back(Spawner(SpawningWorld));
+            }
+        }
+    }
+
+    // Adds a function that prepares the given cell's assets on a background thread before it loads.
+    // NOTE: These functions must not touch the world, OpenGL or any other main thread state.
+    void WorldPartition::AddPrefetcher(const CellCoordinate &Coordinate, const std::function<void()> &Prefetcher) {
+        Cells[Pack(Coordinate)].Prefetchers.push_back(Prefetcher);
+        Dirty = true;
+    }
+
+    // Adds a function that resolves the given cell's assets on the main thread before its actors spawn.
+    void WorldPartition::AddLoader(const CellCoordinate &Coordinate, const std::function<void()> &Loader) {
+        Cells[Pack(Coordinate)].Loaders.push_back(Loader);
+        Dirty = true;
+    }
+
+    // Adds a function that frees the given cell's assets on the main thread after its actors are destroyed.
+    void WorldPartition::AddUnloader(const CellCoordinate &Coordinate, const std::function<void()> &Unloader) {
+        Cells[Pack(Coordinate)].Unloaders.push_back(Unloader);
+        Dirty = true;
+    }
+
+    // STREAMING
+
+    // Loads, unloads and prefetches cells around the given focus position.
+    // This only does work when the focus enters another cell or the partition has changed.
+    void WorldPartition::Update(const glm::vec2 &Focus) {
+        const auto Current = GetCell(Focus);
+        if (!Dirty && Current == FocusCell) {
+            return;
+        }
+        FocusCell = Current;
+        Dirty = false;
+
+        // Unload and forget each active cell that is now too far away
+        for (auto Iterator = ActiveCells.begin(); Iterator != ActiveCells.end();) {
+            auto &Active = Cells.at(*Iterator);
+            const int CellDistance = Distance(Unpack(*Iterator), FocusCell);
+            if (Active.Loaded && CellDistance > std::max(UnloadRadius, LoadRadius)) {
+                UnloadCell(Active);
+            }
+            if (!Active.Loaded && CellDistance > std::max(PrefetchRadius, LoadRadius)) {
+                // Wait for any prefetch still running so it can be started again later
+                if (Active.Prefetch.valid()) {
+                    Active.Prefetch.wait();
+                    Active.Prefetch = {};
+                }
+                Iterator = ActiveCells.erase(Iterator);
+                continue;
+            }
+            ++Iterator;
+        }
+
+        // Prefetch and load each cell around the focus cell
+        const int Radius = std::max(PrefetchRadius, LoadRadius);
+        for (int Y = FocusCell.Y - Radius; Y <= FocusCell.Y + Radius; ++Y) {
+            for (int X = FocusCell.X - Radius; X <= FocusCell.X + Radius; ++X) {
+                const auto Key = Pack({X, Y});
+                const auto Found = Cells.find(Key);
+                if (Found == Cells.end()) {
+                    continue;
+                }
+                ActiveCells.insert(Key);
+                if (Distance({X, Y}, FocusCell) <= LoadRadius) {
+                    LoadCell(Found->second);
+                } else {
+                    PrefetchCell(Found->second);
+                }
+            }
+        }
+    }
+
+    // Unloads every loaded cell.
+    void WorldPartition::UnloadAll() {
+        for (const auto Key: ActiveCells) {
+            UnloadCell(Cells.at(Key));
+        }
+        Dirty = true;
+    }
+}
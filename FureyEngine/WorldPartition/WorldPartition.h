@@ -0,0 +1,191 @@
+// .h
+// World Partition Class Script
+// by Kyle Furey
+
+#pragma once
+#include "../Worlds/World.h"
+
+namespace FureyEngine {
+    /** The integer coordinates of a single cell in a world partition. */
+    struct CellCoordinate final {
+        /** The horizontal index of the cell. */
+        int X = 0;
+
+        /** The vertical index of the cell. */
+        int Y = 0;
+
+        /** Returns whether the given cell coordinates are equal. */
+        [[nodiscard]] bool operator==(const CellCoordinate &Other) const {
+            return X == Other.X && Y == Other.Y;
+        }
+
+        /** Returns whether the given cell coordinates are not equal. */
+        [[nodiscard]] bool operator!=(const CellCoordinate &Other) const {
+            return !(*this == Other);
+        }
+    };
+
+    /**
+     * Divides a world into square cells whose actors are only spawned while a focus position is nearby.<br/>
+     * Cells near the focus are prefetched on a background thread, then loaded once they are within the load radius,<br/>
+     * and unloaded again once they are outside of the unload radius.<br/>
+     * Memory and tick cost are bounded by the area around the focus rather than by the size of the world.
+     */
+    class WorldPartition final {
+        // CELLS
+
+        /** The actors and assets of a single cell. */
+        struct Cell final {
+            /** Each function that spawns one of this cell's actors into a world. */
+            std::vector<std::function<Reference<Actor>(World *)> > Spawners;
+
+            /** Each function that prepares this cell's assets on a background thread before it loads. */
+            std::vector<std::function<void()> > Prefetchers;
+
+            /** Each function that resolves this cell's assets on the main thread before its actors spawn. */
+            std::vector<std::function<void()> > Loaders;
+
+            /** Each function that frees this cell's assets on the main thread after its actors are destroyed. */
+            std::vector<std::function<void()> > Unloaders;
+
+            /** Each actor this cell spawned that may still be in the world. */
+            std::vector<Reference<Actor> > Spawned;
+
+            /** The background prefetch of this cell, which is valid once it has started. */
+            std::future<void> Prefetch;
+
+            /** Whether this cell's actors are currently spawned. */
+            bool Loaded = false;
+        };
+
+        /** The world this partition spawns actors into. */
+        Reference<World> MyWorld;
+
+        /** The width and height of each cell in world space. */
+        const float CellSize;
+
+        /** Each cell with any content by its packed coordinates. */
+        std::unordered_map<long long, Cell> Cells;
+
+        /** The packed coordinates of each cell that is currently prefetching, prefetched or loaded. */
+        std::unordered_set<long long> ActiveCells;
+
+        /** The cell the focus was in during the last update. */
+        CellCoordinate FocusCell;
+
+        /** Whether the active cells need to be updated regardless of whether the focus moved to another cell. */
+        bool Dirty = true;
+
+        /** Returns the given cell coordinates packed into a single key. */
+        [[nodiscard]] static long long Pack(const CellCoordinate &Coordinate);
+
+        /** Returns the given packed key as cell coordinates. */
+        [[nodiscard]] static CellCoordinate Unpack(const long long &Key);
+
+        /** Returns the number of cells between the given cells along whichever axis is furthest. */
+        [[nodiscard]] static int Distance(const CellCoordinate &From, const CellCoordinate &To);
+
+        /** Starts prefetching the given unloaded cell on a background thread if it has not started yet. */
+        void PrefetchCell(Cell &Prefetched);
+
+        /** Waits for the given cell's prefetch, then resolves its assets and spawns its actors. */
+        void LoadCell(Cell &LoadedCell);
+
+        /** Destroys the given cell's actors, then frees its assets. */
+        void UnloadCell(Cell &UnloadedCell);
+
+    public:
+        // STREAMING SETTINGS
+
+        /** The number of cells around the focus cell whose actors are spawned. */
+        int LoadRadius = 1;
+
+        /**
+         * The number of cells around the focus cell that stay loaded once spawned.<br/>
+         * This should be greater than the load radius so crossing a cell border does not reload cells.
+         */
+        int UnloadRadius = 2;
+
+        /** The number of cells around the focus cell that are prefetched on a background thread. */
+        int PrefetchRadius = 2;
+
+        // CONSTRUCTORS
+
+        /** Constructs a new empty world partition for the given world with cells of the given size. */
+        explicit WorldPartition(const Reference<World> &PartitionedWorld, const float &CellSize = 1000);
+
+        /** Delete copy constructor. */
+        WorldPartition(const WorldPartition &Copied) = delete;
+
+        /** Delete move constructor. */
+        WorldPartition(WorldPartition &&Moved) = delete;
+
+        // ASSIGNMENT OPERATORS
+
+        /** Delete copy constructor. */
+        WorldPartition &operator=(const WorldPartition &Copied) = delete;
+
+        /** Delete move constructor. */
+        WorldPartition &operator=(WorldPartition &&Moved) = delete;
+
+        // DESTRUCTOR
+
+        /** Waits for each background prefetch to finish. */
+        ~WorldPartition() = default;
+
+        // CELLS
+
+        /** Returns the width and height of each cell in world space. */
+        [[nodiscard]] float GetCellSize() const;
+
+        /** Returns the coordinates of the cell containing the given world position. */
+        [[nodiscard]] CellCoordinate GetCell(const glm::vec2 &WorldPosition) const;
+
+        /** Returns whether the given cell's actors are currently spawned. */
+        [[nodiscard]] bool IsLoaded(const CellCoordinate &Coordinate) const;
+
+        /** Returns the number of cells whose actors are currently spawned. */
+        [[nodiscard]] int LoadedCount() const;
+
+        /**
+         * Adds an actor of the given type to the cell containing the given transform.<br/>
+         * The actor is spawned with the given arguments each time its cell loads, and destroyed when it unloads.<br/>
+         * The actor is spawned immediately if its cell is already loaded.
+         */
+        template<typename ActorType, typename... ArgumentTypes>
+        void AddActor(const Transform &Transform, ArgumentTypes... Arguments) {
+            AddSpawner(GetCell(Transform.Position), [Transform, Arguments...](World *SpawningWorld) {
+                return Reference<Actor>(SpawningWorld->SpawnActor<ActorType>(Transform, Arguments...).Get());
+            });
+        }
+
+        /**
+         * Adds a function that spawns one of the given cell's actors each time it loads.<br/>
+         * The actor is spawned immediately if the cell is already loaded.
+         */
+        void AddSpawner(const CellCoordinate &Coordinate, const std::function<Reference<Actor>(World *)> &Spawner);
+
+        /**
+         * Adds a function that prepares the given cell's assets on a background thread before it loads.<br/>
+         * NOTE: These functions must not touch the world, OpenGL or any other main thread state.
+         */
+        void AddPrefetcher(const CellCoordinate &Coordinate, const std::function<void()> &Prefetcher);
+
+        /** Adds a function that resolves the given cell's assets on the main thread before its actors spawn. */
+        void AddLoader(const CellCoordinate &Coordinate, const std::function<void()> &Loader);
+
+        /** Adds a function that frees the given cell's assets on the main thread after its actors are destroyed. */
+        void AddUnloader(const CellCoordinate &Coordinate, const std::function<void()> &Unloader);
+
+        // STREAMING
+
+        /**
+         * Loads, unloads and prefetches cells around the given focus position.<br/>
+         * This only does work when the focus enters another cell or the partition has changed.
+         */
+        void Update(const glm::vec2 &Focus);
+
+        /** Unloads every loaded cell. */
+        void UnloadAll();
+    };
+}
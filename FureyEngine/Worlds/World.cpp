@@ -17,9 +17,17 @@ namespace FureyEngine {
 
     // Properly destroys this world.
     World::~World() {
+        Coroutines.Clear();
         --TotalWorlds;
     }
 
+    // REFERENCE
+
+    // Returns this world's handle in the reference registry.
+    const ReferenceHandle &World::GetHandle() const {
+        return MySlot.Handle();
+    }
+
     // TIME
 
     // Returns the time point this world was created.
@@ -47,258 +55,1166 @@ namespace FureyEngine {
         return TotalTicks;
     }
 
+    // Returns the time in seconds between each fixed simulation step, or 0 if this world simulates each tick.
+    double World::GetFixedTimeStep() const {
+        return FixedTimeStep;
+    }
+
+    // Sets the time in seconds between each fixed simulation step, or 0 to simulate once each tick.
+    // Physics, movement and collision components tick once per fixed step,
+    // and rendered actors are interpolated between their last two fixed steps.
+    // Each started actor and component is registered again with its new tick phases.
+    void World::SetFixedTimeStep(const double &FixedTimeStep) {
+        this->FixedTimeStep = FixedTimeStep > 0 ? FixedTimeStep : 0;
+        FixedAccumulator = 0;
+        Interpolation = 1;
+        for (const auto &Actor: Actors) {
+            if (Actor->BeginTick) {
+                RegisterTickPhases(Actor.get());
+            }
+            for (const auto &Component: Actor->Components) {
+                if (Component->BeginTick) {
+                    RegisterTickPhases(Component.get());
+                }
+            }
+        }
+    }
+
+    // Returns how far this world is between its last two fixed simulation steps, from 0 to 1.
+    const double &World::GetInterpolation() const {
+        return Interpolation;
+    }
+
     // Invokes the given function after the given number of seconds.
-    // Returns the scheduled event.
-    World::TimedEvent *World::InvokeAfterSeconds(double Delay,
-                                                 const std::function<void()> &Function) {
-        ScheduledEvents.push_back({Delay, Function});
-        return &ScheduledEvents.back();
+    // Returns a handle that cancels the scheduled event when passed to CancelInvoke().
+    TimerHandle World::InvokeAfterSeconds(double Delay,
+                                          const std::function<void()> &Function) {
+        return ScheduledEvents.Schedule(Delay, 0, 1, Function);
     }
 
     // Invokes the given function after the given number of seconds for the given number of loops.
     // If loops is equal to -1, it will loop forever.
-    // Returns the scheduled event.
-    World::TimedEvent *World::RepeatAfterSeconds(double Delay,
-                                                 const int &Loops,
-                                                 const std::function<void()> &Function) {
-        if (Loops == 0) {
-            return nullptr;
-        }
-        if (Delay <= 0) {
-            Delay = 0.0000001;
-        }
-        ScheduledEvents.push_back({
-            Delay, [=] {
-                Function();
-                RepeatAfterSeconds(Delay, Loops - 1, Function);
-            }
-        });
-        return &ScheduledEvents.back();
+    // Returns a handle that cancels the scheduled event when passed to CancelInvoke().
+    TimerHandle World::RepeatAfterSeconds(double Delay,
+                                          const int &Loops,
+                                          const std::function<void()> &Function) {
+        return ScheduledEvents.Schedule(Delay, Delay, Loops, Function);
     }
 
     // Invokes the given function after the given number of seconds for the given number of loops.
     // This function will loop forever unless cancelled.
-    // Returns the scheduled event.
-    World::TimedEvent *World::RepeatAfterSeconds(const double &Delay, const std::function<void()> &Function) {
+    // Returns a handle that cancels the scheduled event when passed to CancelInvoke().
+    TimerHandle World::RepeatAfterSeconds(const double &Delay, const std::function<void()> &Function) {
         return RepeatAfterSeconds(Delay, -1, Function);
     }
 
     // Invokes the given function the following tick.
-    // Returns the scheduled event.
-    World::TimedEvent *World::InvokeNextTick(const std::function<void()> &Function) {
-        return InvokeAfterSeconds(0.0000001, Function);
+    // Returns a handle that cancels the scheduled event when passed to CancelInvoke().
+    TimerHandle World::InvokeNextTick(const std::function<void()> &Function) {
+        return ScheduledEvents.Schedule(0, 0, 1, Function);
     }
 
-    // Attempt to unschedule the given function from the scheduled events.
+    // Attempt to unschedule the scheduled event with the given handle.
     // Returns if the cancellation was successful.
-    bool World::CancelInvoke(const std::function<void()> &Function) {
-        auto Iterator = ScheduledEvents.begin();
-        for (const auto &[Delay, Event, Invoked]: ScheduledEvents) {
-            if (Event.target<void()>() == Function.target<void()>()) {
-                ScheduledEvents.erase(Iterator);
-                return true;
+    bool World::CancelInvoke(const TimerHandle &Handle) {
+        return ScheduledEvents.Cancel(Handle);
+    }
+
+    // Returns whether the scheduled event with the given handle has not been invoked or cancelled yet.
+    bool World::IsInvokeScheduled(const TimerHandle &Handle) const {
+        return ScheduledEvents.IsScheduled(Handle);
+    }
+
+    // COROUTINES
+
+    // Starts the given coroutine, which runs until it first co_awaits Seconds(), NextTick() or NextInvoke().
+    // It is then resumed once its wait is over, after this world's scheduled events.
+    // If an owner is given, the coroutine is stopped as soon as its owner is destroyed or returned to its pool.
+    // Returns a handle that stops the coroutine when passed to StopCoroutine().
+    CoroutineHandle World::StartCoroutine(Coroutine Script, const Reference<Actor> &Owner) {
+        if (!Owner) {
+            return Coroutines.Start(std::move(Script));
+        }
+        Owner->OwnsCoroutines = true;
+        return Coroutines.Start(std::move(Script), Owner->GetHandle());
+    }
+
+    // Stops the coroutine with the given handle, destroying each of its local variables.
+    // Returns if the coroutine was still running.
+    bool World::StopCoroutine(const CoroutineHandle &Handle) {
+        return Coroutines.Stop(Handle);
+    }
+
+    // Returns whether the coroutine with the given handle has not finished or been stopped yet.
+    bool World::IsCoroutineRunning(const CoroutineHandle &Handle) const {
+        return Coroutines.IsRunning(Handle);
+    }
+
+    // Returns the number of coroutines running in this world.
+    int World::CoroutineCount() const {
+        return Coroutines.Count();
+    }
+
+    // Stops each coroutine owned by the given destroyed actor so none of them wait to be resumed.
+    void World::StopOwnedCoroutines(Actor *DestroyedActor) {
+        if (DestroyedActor->OwnsCoroutines) {
+            DestroyedActor->OwnsCoroutines = false;
+            Coroutines.StopOwned(DestroyedActor->GetHandle());
+        }
+    }
+
+    // DETERMINISM
+
+    // Returns whether this world advances by a set delta time each tick instead of the elapsed real time.
+    bool World::IsDeterministic() const {
+        return DeterministicDeltaTime > 0;
+    }
+
+    // Makes this world advance by exactly the given delta time each tick instead of the elapsed real time,
+    // and reseeds its random number generator with the given seed.
+    // Two runs with the same seed and inputs then produce identical state if actors only use GetRandom().
+    // Call this before this world's first update so its elapsed time also starts from 0.
+    // Pass a delta time of 0 to use the elapsed real time again.
+    void World::SetDeterministic(const double &TickDeltaTime, const unsigned long long &Seed) {
+        DeterministicDeltaTime = std::max(TickDeltaTime, 0.0);
+        if (DeterministicDeltaTime > 0) {
+            MyRandom.Seed(Seed);
+
+            // Start the elapsed time from 0 if this world has not ticked yet
+            if (!BeginTick) {
+                CurrentTimePoint = LoadTimePoint;
+            }
+        }
+    }
+
+    // Returns this world's random number generator, which is reseeded by SetDeterministic().
+    // NOTE: This must not be used by components ticking in parallel since the order they draw numbers in is not fixed.
+    Random &World::GetRandom() {
+        return MyRandom;
+    }
+
+    // SNAPSHOTS
+
+    // Saves this world's time, random number generator, scheduled events, and each actor and component
+    // of a type registered with Snapshot::RegisterActor() or Snapshot::RegisterComponent() into a snapshot.
+    // NOTE: This must be called between updates.
+    Snapshot World::SaveSnapshot() const {
+        Snapshot Saved;
+        SnapshotWriter Writer;
+
+        // The type table is written last once every saved type is known
+        const size_t TableOffset = Writer.Size();
+        Writer.Write(static_cast<unsigned long long>(0));
+
+        // Save this world's state
+        Writer.Write(TotalTicks);
+        Writer.Write(CurrentDeltaTime);
+        Writer.Write(FixedAccumulator);
+        Writer.Write(Interpolation);
+        Writer.Write(static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            CurrentTimePoint - LoadTimePoint).count()));
+        Writer.Write(MyRandom);
+        Writer.Write(SpawnedObjects);
+
+        // Save the timing of each scheduled event, keeping their functions in memory
+        ScheduledEvents.Save(Writer, Saved.Events);
+
+        // Save each actor of a registered type and its components of registered types
+        std::unordered_map<std::type_index, unsigned int> ActorIndices;
+        std::unordered_map<std::type_index, unsigned int> ComponentIndices;
+        std::vector<std::string> ActorNames;
+        std::vector<std::string> ComponentNames;
+        const size_t CountOffset = Writer.Size();
+        unsigned int ActorCount = 0;
+        Writer.Write(ActorCount);
+        for (const auto List: {&Actors, &PendingActors}) {
+            for (const auto &Actor: *List) {
+                const std::type_index ActorType = typeid(*Actor);
+                auto FoundActor = ActorIndices.find(ActorType);
+                if (FoundActor == ActorIndices.end()) {
+                    const auto Registered = Snapshot::FindActorType(ActorType);
+                    if (Registered == nullptr) {
+                        continue;
+                    }
+                    FoundActor = ActorIndices.emplace(ActorType, static_cast<unsigned int>(ActorNames.size())).first;
+                    ActorNames.push_back(Registered->Name);
+                }
+                Writer.Write(FoundActor->second);
+                Writer.Write(Actor->SpawnOrder);
+
+                // Each record is prefixed with its length so it can be skipped without loading it
+                const size_t RecordOffset = Writer.Size();
+                Writer.Write(static_cast<unsigned long long>(0));
+                const size_t ActorOffset = Writer.Size();
+                Writer.Write(static_cast<unsigned long long>(0));
+                Actor->Save(Writer);
+                Writer.Overwrite(ActorOffset, static_cast<unsigned long long>(Writer.Size() - ActorOffset - 8));
+
+                const size_t ComponentCountOffset = Writer.Size();
+                unsigned int ComponentCount = 0;
+                Writer.Write(ComponentCount);
+                for (const auto &Component: Actor->Components) {
+                    const std::type_index ComponentType = typeid(*Component);
+                    auto FoundComponent = ComponentIndices.find(ComponentType);
+                    if (FoundComponent == ComponentIndices.end()) {
+                        const auto Registered = Snapshot::FindComponentType(ComponentType);
+                        if (Registered == nullptr) {
+                            continue;
+                        }
+                        FoundComponent = ComponentIndices.emplace(
+                            ComponentType, static_cast<unsigned int>(ComponentNames.size())).first;
+                        ComponentNames.push_back(Registered->Name);
+                    }
+                    Writer.Write(FoundComponent->second);
+                    Writer.Write(Component->AttachOrder);
+                    const size_t ComponentOffset = Writer.Size();
+                    Writer.Write(static_cast<unsigned long long>(0));
+                    Component->Save(Writer);
+                    Writer.Overwrite(ComponentOffset,
+                                     static_cast<unsigned long long>(Writer.Size() - ComponentOffset - 8));
+                    ++ComponentCount;
+                }
+                Writer.Overwrite(ComponentCountOffset, ComponentCount);
+                Writer.Overwrite(RecordOffset, static_cast<unsigned long long>(Writer.Size() - RecordOffset - 8));
+                ++ActorCount;
+            }
+        }
+        Writer.Overwrite(CountOffset, ActorCount);
+
+        // Save the name of each type so snapshots do not depend on registration order
+        Writer.Overwrite(TableOffset, static_cast<unsigned long long>(Writer.Size()));
+        Writer.Write(static_cast<unsigned int>(ActorNames.size()));
+        for (const auto &TypeName: ActorNames) {
+            Writer.Write(TypeName);
+        }
+        Writer.Write(static_cast<unsigned int>(ComponentNames.size()));
+        for (const auto &TypeName: ComponentNames) {
+            Writer.Write(TypeName);
+        }
+
+        Saved.RawSize = Writer.Buffer.size();
+        Saved.CompressedBytes = Snapshot::Compress(Writer.Buffer.data(), Writer.Buffer.size());
+        return Saved;
+    }
+
+    // Destroys each actor in this world and restores the state saved in the given snapshot.
+    // Restored actors and components call their spawn, attach and start events again on the next update.
+    // Coroutines cannot be saved, so each running coroutine is stopped.
+    // NOTE: This must be called between updates.
+    void World::LoadSnapshot(const Snapshot &Loaded) {
+        if (Loaded.IsEmpty()) {
+            throw std::runtime_error("ERROR: Cannot load an empty snapshot into world \"" + Name + "\"!");
+        }
+        const auto Bytes = Snapshot::Decompress(Loaded.CompressedBytes.data(), Loaded.CompressedBytes.size(),
+                                                Loaded.RawSize);
+        SnapshotReader Reader(Bytes.data(), Bytes.size());
+
+        // Resolve each saved type name before changing anything
+        const auto TableOffset = Reader.Read<unsigned long long>();
+        const size_t StateOffset = Reader.Tell();
+        Reader.Seek(TableOffset);
+        std::vector<const Snapshot::RegisteredActor *> ActorTypes(Reader.Read<unsigned int>());
+        for (auto &Type: ActorTypes) {
+            const auto TypeName = Reader.Read<std::string>();
+            Type = Snapshot::FindActorType(TypeName);
+            if (Type == nullptr) {
+                throw std::runtime_error("ERROR: Snapshot actor type \"" + TypeName + "\" is not registered!");
+            }
+        }
+        std::vector<const Snapshot::RegisteredComponent *> ComponentTypes(Reader.Read<unsigned int>());
+        for (auto &Type: ComponentTypes) {
+            const auto TypeName = Reader.Read<std::string>();
+            Type = Snapshot::FindComponentType(TypeName);
+            if (Type == nullptr) {
+                throw std::runtime_error("ERROR: Snapshot component type \"" + TypeName + "\" is not registered!");
+            }
+            if (Type->Attach == nullptr) {
+                throw std::runtime_error("ERROR: Snapshot component type \"" + TypeName + "\" cannot be attached!");
+            }
+        }
+        Reader.Seek(StateOffset);
+
+        // Stop each coroutine and destroy each current actor
+        Coroutines.Clear();
+        for (const auto List: {&Actors, &PendingActors}) {
+            for (const auto &Actor: *List) {
+                DestroyActor(Actor.get());
+            }
+        }
+        FlushCommands();
+        CompactTickPhases();
+
+        // Restore this world's state
+        Reader.Read(TotalTicks);
+        Reader.Read(CurrentDeltaTime);
+        Reader.Read(FixedAccumulator);
+        Reader.Read(Interpolation);
+        const auto Elapsed = Reader.Read<long long>();
+        if (DeterministicDeltaTime > 0) {
+            CurrentTimePoint = LoadTimePoint + std::chrono::duration_cast<
+                                   std::chrono::high_resolution_clock::duration>(std::chrono::nanoseconds(Elapsed));
+        }
+        Reader.Read(MyRandom);
+        const auto SavedObjects = Reader.Read<unsigned long long>();
+
+        // Restore scheduled events if their functions were kept in memory
+        ScheduledEvents.Load(Reader, Loaded.Events);
+
+        // Find each actor record so consecutive actors of the same type can be spawned together
+        struct ActorRecord final {
+            const Snapshot::RegisteredActor *Type;
+            unsigned long long Order;
+            size_t Offset;
+            size_t End;
+        };
+        std::vector<ActorRecord> Records(Reader.Read<unsigned int>());
+        for (auto &Record: Records) {
+            const auto TypeIndex = Reader.Read<unsigned int>();
+            if (TypeIndex >= ActorTypes.size()) {
+                throw std::runtime_error("ERROR: Snapshot data is corrupted!");
+            }
+            Record.Type = ActorTypes[TypeIndex];
+            Reader.Read(Record.Order);
+            const auto Length = Reader.Read<unsigned long long>();
+            Record.Offset = Reader.Tell();
+            Record.End = Record.Offset + Length;
+            Reader.Seek(Record.End);
+        }
+
+        // Spawn and load each actor and its components in the order they were saved
+        for (size_t First = 0; First < Records.size();) {
+            size_t Last = First + 1;
+            while (Last < Records.size() && Records[Last].Type == Records[First].Type) {
+                ++Last;
+            }
+            const auto Spawned = Records[First].Type->Spawn(this, static_cast<int>(Last - First));
+            for (size_t i = First; i < Last; ++i) {
+                const auto Actor = Spawned[i - First];
+                Actor->SpawnOrder = Records[i].Order;
+                Reader.Seek(Records[i].Offset);
+                const auto ActorLength = Reader.Read<unsigned long long>();
+                const size_t ActorEnd = Reader.Tell() + ActorLength;
+                Actor->Load(Reader);
+                Reader.Seek(ActorEnd);
+
+                const auto ComponentCount = Reader.Read<unsigned int>();
+                for (unsigned int j = 0; j < ComponentCount; ++j) {
+                    const auto TypeIndex = Reader.Read<unsigned int>();
+                    if (TypeIndex >= ComponentTypes.size()) {
+                        throw std::runtime_error("ERROR: Snapshot data is corrupted!");
+                    }
+                    const auto Order = Reader.Read<unsigned long long>();
+                    const auto ComponentLength = Reader.Read<unsigned long long>();
+                    const size_t ComponentEnd = Reader.Tell() + ComponentLength;
+                    const auto Component = ComponentTypes[TypeIndex]->Attach(Actor);
+                    Component->AttachOrder = Order;
+                    Component->Load(Reader);
+                    Reader.Seek(ComponentEnd);
+                }
+                Actor->PostLoad();
+                Reader.Seek(Records[i].End);
             }
-            ++Iterator;
+            First = Last;
+        }
+        SpawnedObjects = SavedObjects;
+    }
+
+    // COMMANDS
+
+    // Sets whether the given actor in this world is active at the end of the tick.
+    void World::SetActorActive(const Actor *ActivatedActor, const bool &Active) {
+        if (ActivatedActor == nullptr || ActivatedActor->GetWorld().Get() != this) {
+            return;
         }
-        return false;
+        Commands.Record(Active ? CommandType::ACTIVATE : CommandType::DEACTIVATE,
+                        const_cast<Actor *>(ActivatedActor), nullptr, ActivatedActor->GetHandle());
+    }
+
+    // Sets whether the given component in this world is active at the end of the tick.
+    void World::SetComponentActive(const Component *ActivatedComponent, const bool &Active) {
+        if (ActivatedComponent == nullptr || !ActivatedComponent->GetActor() ||
+            ActivatedComponent->GetActor()->GetWorld().Get() != this) {
+            return;
+        }
+        Commands.Record(Active ? CommandType::ACTIVATE : CommandType::DEACTIVATE,
+                        ActivatedComponent->GetActor().Get(), const_cast<Component *>(ActivatedComponent),
+                        ActivatedComponent->GetHandle());
+    }
+
+    // Returns each structural change recorded since this world's last sync point.
+    const CommandBuffer &World::GetCommands() const {
+        return Commands;
+    }
+
+    // Applies each structural change recorded since this world's last sync point in order of their kind.
+    // Spawns and attaches are applied before actors tick, and every other change at the end of each Update().
+    void World::FlushCommands() {
+        ApplyCommands(CommandType::DESTROY);
     }
 
     // ACTORS
 
     // Updates the current state of this world and its actors.
+    // Each phase ticks every registered actor, then every registered component,
+    // rather than ticking each actor's components right after it.
     // Call this in each update loop.
     void World::Update() {
         // Check if this world is active
         if (!Active) {
             return;
         }
+        PROFILE_ZONE("World::Update");
 
         if (BeginTick) {
             // TICK
 
             // Update delta time
-            CurrentDeltaTime = static_cast<std::chrono::duration<double>>(
-                                   std::chrono::high_resolution_clock::now() - CurrentTimePoint).count() * TimeScale;
-            CurrentTimePoint = std::chrono::high_resolution_clock::now();
+            if (DeterministicDeltaTime > 0) {
+                CurrentDeltaTime = DeterministicDeltaTime * TimeScale;
+                CurrentTimePoint += std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+                    std::chrono::duration<double>(DeterministicDeltaTime));
+            } else {
+                CurrentDeltaTime = static_cast<std::chrono::duration<double>>(
+                                       std::chrono::high_resolution_clock::now() - CurrentTimePoint).count() *
+                                   TimeScale;
+                CurrentTimePoint = std::chrono::high_resolution_clock::now();
+            }
 
             // Ensure delta time is not 0
             if (CurrentDeltaTime <= 0) {
                 CurrentDeltaTime = 0.0000001;
             }
 
-            // Call and clear scheduled events
-            auto Iterator = ScheduledEvents.begin();
-            for (auto &[Delay, Event, Invoked]: ScheduledEvents) {
-                Delay -= CurrentDeltaTime;
-                ++Iterator;
-            }
+            // Call scheduled events that are now due
+            ScheduledEvents.Advance(CurrentDeltaTime);
 
-            Iterator = ScheduledEvents.begin();
-            for (auto &[Delay, Event, Invoked]: ScheduledEvents) {
-                if (Delay <= 0) {
-                    Event();
-                    Invoked = true;
-                    Cleanup.Bind([&, Iterator] { ScheduledEvents.erase(Iterator); });
-                }
-                ++Iterator;
-            }
+            // Resume coroutines whose wait is over
+            Coroutines.Advance(CurrentDeltaTime);
 
             // Call world tick events
             Tick(CurrentDeltaTime);
             OnTick(this, CurrentDeltaTime);
 
+            // Apply spawns and attaches recorded before actors tick
+            ApplyCommands(CommandType::ATTACH);
+
+            // Call fixed tick events for each elapsed simulation step
+            SimulateFixedSteps();
+
             // Call actor tick events
-            for (const auto &Actor: Actors) {
-                if (!Actor->IsActive()) {
-                    continue;
-                }
-                if (Actor->BeginTick) {
-                    Actor->Tick(CurrentDeltaTime);
-                    Actor->OnTick(Actor.get(), CurrentDeltaTime);
-                } else {
-                    Actor->Spawn();
-                    Actor->OnSpawn(Actor.get());
-                }
+            TickActors();
 
-                // Call component tick events
-                for (auto &Component: Actor->Components) {
-                    if (!Component->IsActive()) {
-                        continue;
-                    }
-                    if (Component->BeginTick) {
-                        Component->Tick(CurrentDeltaTime);
-                        Component->OnTick(Component.get(), CurrentDeltaTime);
-                    } else {
-                        Component->Attach();
-                        Component->OnAttach(Component.get());
-                    }
-                }
-            }
+            // Dispatch events published while actors ticked
+            Bus.Dispatch();
 
             // Call world late tick events
             LateTick(CurrentDeltaTime);
             OnLateTick(this, CurrentDeltaTime);
 
             // Call actor late tick events
-            for (const auto &Actor: Actors) {
-                if (!Actor->IsActive()) {
-                    continue;
-                }
-                if (Actor->BeginTick) {
-                    Actor->LateTick(CurrentDeltaTime);
-                    Actor->OnLateTick(Actor.get(), CurrentDeltaTime);
-                } else {
-                    Actor->Start();
-                    Actor->OnStart(Actor.get());
-                    Actor->BeginTick = true;
-                }
+            LateTickActors();
 
-                // Call component late tick events
-                for (auto &Component: Actor->Components) {
-                    if (!Component->IsActive()) {
-                        continue;
-                    }
-                    if (Component->BeginTick) {
-                        Component->LateTick(CurrentDeltaTime);
-                        Component->OnLateTick(Component.get(), CurrentDeltaTime);
-                    } else {
-                        Component->Start();
-                        Component->OnStart(Component.get());
-                        Component->BeginTick = true;
-                    }
-                }
-            }
+            // Dispatch events published while actors late ticked
+            Bus.Dispatch();
         } else {
             // START
 
             // Update the current time
-            CurrentTimePoint = std::chrono::high_resolution_clock::now();
+            if (DeterministicDeltaTime <= 0) {
+                CurrentTimePoint = std::chrono::high_resolution_clock::now();
+            }
 
             // Call world load events
             Load();
             OnLoad(this);
 
+            // Apply spawns and attaches recorded before actors tick
+            ApplyCommands(CommandType::ATTACH);
+
             // Call actor tick events
-            for (const auto &Actor: Actors) {
-                if (!Actor->IsActive()) {
+            TickActors();
+
+            // Dispatch events published while actors ticked
+            Bus.Dispatch();
+
+            // Call world start events
+            Start();
+            OnStart(this);
+
+            // Call actor late tick events
+            LateTickActors();
+
+            // Dispatch events published while actors late ticked
+            Bus.Dispatch();
+
+            BeginTick = true;
+        }
+
+        // Apply structural changes recorded during this update
+        FlushCommands();
+
+        // Call cleanup events
+        Cleanup();
+        Cleanup.Clear();
+
+        // Remove destroyed actors and components from each tick phase
+        CompactTickPhases();
+
+        ++TotalTicks;
+    }
+
+    // Calls destroy events on the given pooled actor and its components, then moves it into its pool.
+    void World::ReturnToPool(Actor *PooledActor) {
+        // Call remove events and unregister each component
+        for (const auto &Component: PooledActor->Components) {
+            Component->ActiveBeforePool = Component->IsActive();
+            if (Component->Attached) {
+                Component->Remove();
+                Component->OnRemove(Component.get());
+                Component->Attached = false;
+            }
+            UnregisterTickPhases(Component.get());
+            if (Component->Table != nullptr) {
+                Component->Table->Remove(Component.get());
+            }
+            Component->BeginTick = false;
+            Component->Reset();
+        }
+
+        // Call destroy events
+        PooledActor->Destroy();
+        PooledActor->OnDestroy(PooledActor);
+        UnregisterTickPhases(PooledActor);
+        UnindexActor(PooledActor);
+        StopOwnedCoroutines(PooledActor);
+        PooledActor->BeginTick = false;
+        PooledActor->Reset();
+
+        // Invalidate each reference to this actor and move it into its pool
+        PooledActor->MySlot.Renew();
+        PooledActor->Pool->Inactive.splice(PooledActor->Pool->Inactive.end(), Actors, PooledActor->WorldIterator);
+    }
+
+    // Moves the given pooled actor back into this world and queues it and its components to spawn again.
+    // Actors that have spawned before are reused instead, keeping the components they attached.
+    void World::ReactivateFromPool(Actor *PooledActor, const Transform &Transform) {
+        PendingActors.splice(PendingActors.end(), PooledActor->Pool->Inactive, PooledActor->WorldIterator);
+        PooledActor->Transform = Transform;
+        PooledActor->PreviousTransform = Transform;
+        PooledActor->SpawnTimePoint = std::chrono::high_resolution_clock::now();
+        PooledActor->Active = true;
+        Commands.Record(CommandType::SPAWN, PooledActor, nullptr, PooledActor->GetHandle());
+        IndexActor(PooledActor);
+
+        // Queue each component to be attached again as active as it was before it was removed
+        for (const auto &Component: PooledActor->Components) {
+            Component->MyActor = PooledActor;
+            Component->Active = Component->ActiveBeforePool;
+            Component->AttachTimePoint = PooledActor->SpawnTimePoint;
+            if (Component->Table != nullptr) {
+                Component->Table->Add(Component.get(), PooledActor);
+            }
+            Commands.Record(CommandType::ATTACH, PooledActor, Component.get(), Component->GetHandle());
+        }
+    }
+
+    // Applies each recorded command up to and including the given kind in order of their kind.
+    void World::ApplyCommands(const CommandType &Last) {
+        PROFILE_ZONE("World::ApplyCommands");
+
+        // Commands recorded while applying are applied in the next pass
+        bool Applying = true;
+        while (Applying) {
+            Applying = false;
+            for (int Type = 0; Type <= static_cast<int>(Last); ++Type) {
+                auto &List = Commands.Commands[Type];
+                for (size_t i = 0; i < List.size(); ++i) {
+                    const Command Applied = List[i];
+                    ApplyCommand(static_cast<CommandType>(Type), Applied);
+                    Applying = true;
+                }
+                List.clear();
+            }
+        }
+    }
+
+    // Applies the given recorded command of the given kind if its object still exists.
+    void World::ApplyCommand(const CommandType &Type, const Command &Applied) {
+        if (!ReferenceRegistry::IsValid(Applied.Handle)) {
+            return;
+        }
+
+        const auto Actor = Applied.TargetActor;
+        const auto Component = Applied.TargetComponent;
+        switch (Type) {
+            case CommandType::SPAWN:
+                // Move this actor into this world's actor list and queue its spawn events
+                Actors.splice(Actors.end(), PendingActors, Actor->WorldIterator);
+                SpawningActors.push_back(Actor);
+                break;
+
+            case CommandType::ATTACH:
+                // Queue this component's attach events
+                AttachingComponents.push_back({Component, Actor});
+                break;
+
+            case CommandType::ACTIVATE:
+            case CommandType::DEACTIVATE:
+                if (Component != nullptr) {
+                    Component->SetActive(Type == CommandType::ACTIVATE);
+                } else {
+                    Actor->SetActive(Type == CommandType::ACTIVATE);
+                }
+                break;
+
+            case CommandType::REMOVE:
+                // Call remove events if this component was attached
+                if (Component->Attached) {
+                    Component->Remove();
+                    Component->OnRemove(Component);
+                }
+
+                // Delete this component
+                Actor->RemoveFromWorld(Component);
+                Actor->UnindexComponent(Component);
+                Actor->Components.erase(Component->ActorIterator);
+                break;
+
+            case CommandType::DESTROY:
+                if (Actor->Pool != nullptr) {
+                    ReturnToPool(Actor);
+                    break;
+                }
+
+                // Call destroy events
+                Actor->Destroy();
+                Actor->OnDestroy(Actor);
+
+                // Delete this actor
+                UnregisterTickPhases(Actor);
+                UnindexActor(Actor);
+                StopOwnedCoroutines(Actor);
+                Actors.erase(Actor->WorldIterator);
+                break;
+        }
+    }
+
+    // Calls spawn and attach events on each pending actor and component, then tick events on each registered one.
+    // Actors spawned and components attached by spawn events are spawned and attached on this update too.
+    // Every registered actor ticks before every registered component.
+    void World::TickActors() {
+        PROFILE_ZONE("World::TickActors");
+
+        // Call actor spawn events until they spawn no more actors
+        size_t Waiting;
+        do {
+            for (size_t i = 0; i < SpawningActors.size(); ++i) {
+                const auto Actor = SpawningActors[i];
+                if (Actor == nullptr || !Actor->IsActive()) {
                     continue;
                 }
-                if (Actor->BeginTick) {
-                    Actor->Tick(CurrentDeltaTime);
-                    Actor->OnTick(Actor.get(), CurrentDeltaTime);
+                if (Actor->Spawned) {
+                    Actor->Reuse();
                 } else {
+                    Actor->Spawned = true;
                     Actor->Spawn();
-                    Actor->OnSpawn(Actor.get());
+                    Actor->OnSpawn(Actor);
                 }
+                Actor->PreviousTransform = Actor->Transform;
+                StartingActors.push_back(Actor);
+                SpawningActors[i] = nullptr;
+            }
+            SpawningActors.erase(std::remove(SpawningActors.begin(), SpawningActors.end(), nullptr),
+                                 SpawningActors.end());
 
-                // Call component tick events
-                for (auto &Component: Actor->Components) {
-                    if (!Component->IsActive()) {
-                        continue;
-                    }
-                    if (Component->BeginTick) {
-                        Component->Tick(CurrentDeltaTime);
-                        Component->OnTick(Component.get(), CurrentDeltaTime);
-                    } else {
-                        Component->Attach();
-                        Component->OnAttach(Component.get());
-                    }
-                }
+            // Apply the spawns and attachments recorded by spawn events so they start on this update
+            Waiting = SpawningActors.size();
+            ApplyCommands(CommandType::ATTACH);
+        } while (SpawningActors.size() > Waiting);
+
+        // Call component attach events
+        for (size_t i = 0; i < AttachingComponents.size(); ++i) {
+            const auto [Component, Actor] = AttachingComponents[i];
+            if (Component == nullptr || !Actor->IsActive() || !Component->IsActive()) {
+                continue;
             }
+            Component->Attached = true;
+            Component->Attach();
+            Component->OnAttach(Component);
+            StartingComponents.push_back(AttachingComponents[i]);
+            AttachingComponents[i].Object = nullptr;
+        }
+        AttachingComponents.erase(std::remove_if(AttachingComponents.begin(), AttachingComponents.end(),
+                                                 [](const ComponentEntry &Entry) { return Entry.Object == nullptr; }),
+                                  AttachingComponents.end());
 
-            // Call world start events
-            Start();
-            OnStart(this);
+        // Call actor tick events
+        for (size_t i = 0; i < TickingActors[0].size(); ++i) {
+            const auto Actor = TickingActors[0][i];
+            if (Actor == nullptr || !Actor->IsActive()) {
+                continue;
+            }
+            double DeltaTime;
+            if (!ConsumeTick(Actor->Throttle, Actor, 0, DeltaTime)) {
+                continue;
+            }
+            PROFILE_ZONE(typeid(*Actor).name());
+            Actor->Tick(DeltaTime);
+            Actor->OnTick(Actor, DeltaTime);
+        }
 
-            // Call actor late tick events
+        // Call component tick events
+        TickComponents(0);
+    }
+
+    // Calls late tick events on each registered actor and component, then start events on each pending one.
+    void World::LateTickActors() {
+        PROFILE_ZONE("World::LateTickActors");
+
+        // Call actor late tick events
+        for (size_t i = 0; i < TickingActors[1].size(); ++i) {
+            const auto Actor = TickingActors[1][i];
+            if (Actor == nullptr || !Actor->IsActive()) {
+                continue;
+            }
+            double DeltaTime;
+            if (!ConsumeTick(Actor->Throttle, Actor, 1, DeltaTime)) {
+                continue;
+            }
+            PROFILE_ZONE(typeid(*Actor).name());
+            Actor->LateTick(DeltaTime);
+            Actor->OnLateTick(Actor, DeltaTime);
+        }
+
+        // Call component late tick events
+        TickComponents(1);
+
+        // Call actor start events and register their tick phases
+        for (size_t i = 0; i < StartingActors.size(); ++i) {
+            const auto Actor = StartingActors[i];
+            if (Actor == nullptr || !Actor->IsActive()) {
+                continue;
+            }
+            Actor->Start();
+            Actor->OnStart(Actor);
+            Actor->BeginTick = true;
+            RegisterTickPhases(Actor);
+            StartingActors[i] = nullptr;
+        }
+        StartingActors.erase(std::remove(StartingActors.begin(), StartingActors.end(), nullptr),
+                             StartingActors.end());
+
+        // Call component start events and register their tick phases
+        for (size_t i = 0; i < StartingComponents.size(); ++i) {
+            const auto [Component, Actor] = StartingComponents[i];
+            if (Component == nullptr || !Actor->IsActive() || !Component->IsActive()) {
+                continue;
+            }
+            Component->Start();
+            Component->OnStart(Component);
+            Component->BeginTick = true;
+            RegisterTickPhases(Component);
+            StartingComponents[i].Object = nullptr;
+        }
+        StartingComponents.erase(std::remove_if(StartingComponents.begin(), StartingComponents.end(),
+                                                [](const ComponentEntry &Entry) { return Entry.Object == nullptr; }),
+                                 StartingComponents.end());
+    }
+
+    // Calls fixed tick events once for each whole fixed simulation step that has elapsed.
+    // Without a fixed time step, fixed tick events are called once with the current delta time.
+    void World::SimulateFixedSteps() {
+        PROFILE_ZONE("World::SimulateFixedSteps");
+        if (FixedTimeStep <= 0) {
+            TickFixedPhases();
+            return;
+        }
+
+        // Each step ticks with the fixed time step as its delta time
+        const double TickDeltaTime = CurrentDeltaTime;
+        CurrentDeltaTime = FixedTimeStep;
+        FixedAccumulator += TickDeltaTime;
+        int Steps = 0;
+        while (FixedAccumulator >= FixedTimeStep) {
+            // Drop the remaining time rather than falling further behind
+            if (Steps == MaxFixedSteps) {
+                FixedAccumulator = std::fmod(FixedAccumulator, FixedTimeStep);
+                break;
+            }
+
+            // Store each actor's transform to interpolate from
             for (const auto &Actor: Actors) {
-                if (!Actor->IsActive()) {
+                Actor->PreviousTransform = Actor->Transform;
+            }
+
+            TickFixedPhases();
+            FixedAccumulator -= FixedTimeStep;
+            ++Steps;
+        }
+        CurrentDeltaTime = TickDeltaTime;
+        Interpolation = FixedAccumulator / FixedTimeStep;
+    }
+
+    // Calls fixed tick and fixed late tick events on each registered actor and component.
+    void World::TickFixedPhases() {
+        for (int Phase = 2; Phase < TICK_PHASE_COUNT; ++Phase) {
+            for (size_t i = 0; i < TickingActors[Phase].size(); ++i) {
+                const auto Actor = TickingActors[Phase][i];
+                if (Actor == nullptr || !Actor->IsActive()) {
                     continue;
                 }
-                if (Actor->BeginTick) {
-                    Actor->LateTick(CurrentDeltaTime);
-                    Actor->OnLateTick(Actor.get(), CurrentDeltaTime);
+                PROFILE_ZONE(typeid(*Actor).name());
+                if (Phase == 2) {
+                    Actor->Tick(CurrentDeltaTime);
+                    Actor->OnTick(Actor, CurrentDeltaTime);
                 } else {
-                    Actor->Start();
-                    Actor->OnStart(Actor.get());
-                    Actor->BeginTick = true;
+                    Actor->LateTick(CurrentDeltaTime);
+                    Actor->OnLateTick(Actor, CurrentDeltaTime);
                 }
+            }
+            TickComponents(Phase);
+        }
+    }
 
-                // Call component late tick events
-                for (auto &Component: Actor->Components) {
-                    if (!Component->IsActive()) {
-                        continue;
-                    }
-                    if (Component->BeginTick) {
-                        Component->LateTick(CurrentDeltaTime);
-                        Component->OnLateTick(Component.get(), CurrentDeltaTime);
-                    } else {
-                        Component->Start();
-                        Component->OnStart(Component.get());
-                        Component->BeginTick = true;
-                    }
+    // Calls tick or late tick events on the given component.
+    // Even phases call tick events and odd phases call late tick events.
+    void World::TickComponent(Component *TickedComponent, const int &Phase, const double &DeltaTime) const {
+        PROFILE_ZONE(typeid(*TickedComponent).name());
+        if (Phase % 2 == 0) {
+            TickedComponent->Tick(DeltaTime);
+            TickedComponent->OnTick(TickedComponent, DeltaTime);
+        } else {
+            TickedComponent->LateTick(DeltaTime);
+            TickedComponent->OnLateTick(TickedComponent, DeltaTime);
+        }
+    }
+
+    // Returns whether an object with the given throttle and owning actor should tick in the given phase.
+    // Fixed phases always tick. Otherwise the delta time accumulated since the object's last tick
+    // is written to the given output once its tick rate at its owner's current relevance has elapsed.
+    bool World::ConsumeTick(TickThrottle &Throttle, Actor *Owner, const int &Phase, double &DeltaTime) const {
+        DeltaTime = CurrentDeltaTime;
+        if (Phase >= 2 || Throttle.Rate.IsEveryTick()) {
+            return true;
+        }
+
+        // Evaluate the owner's relevance once per tick and share it with its components
+        int Multiplier = 1;
+        if (RelevancePolicy != nullptr && Throttle.Rate.IsRelevant()) {
+            if (Owner->RelevanceTick != TotalTicks) {
+                Owner->Relevance = RelevancePolicy(Owner);
+                Owner->RelevanceTick = TotalTicks;
+            }
+            Multiplier = Throttle.Rate.Multiplier(Owner->Relevance);
+        }
+        return Throttle.Consume(Phase, CurrentDeltaTime, Multiplier, DeltaTime);
+    }
+
+    // Calls each registered component's events for the given tick phase.
+    // Components with parallel tick dependencies are batched and ticked across this world's workers.
+    void World::TickComponents(const int &Phase) {
+        auto &Entries = TickingComponents[Phase];
+        size_t i = 0;
+        while (i < Entries.size()) {
+            const auto [First, FirstOwner] = Entries[i];
+            if (First == nullptr || !FirstOwner->IsActive() || !First->IsActive()) {
+                ++i;
+                continue;
+            }
+
+            // Tick undeclared components and components with bound tick events serially on this thread
+            if (Workers == nullptr || !First->GetTickDependencies().IsParallel() ||
+                First->OnTick.Count() > 0 || First->OnLateTick.Count() > 0) {
+                double DeltaTime;
+                if (ConsumeTick(First->Throttle, FirstOwner, Phase, DeltaTime)) {
+                    TickComponent(First, Phase, DeltaTime);
                 }
+                ++i;
+                continue;
             }
 
-            BeginTick = true;
+            // Gather the following parallel components until one depends on another actor in the batch
+            ParallelBatch.clear();
+            Actor *Writer = nullptr;
+            Actor *Reader = nullptr;
+            bool ManyWriters = false;
+            bool ManyReaders = false;
+            for (; i < Entries.size(); ++i) {
+                const auto Entry = Entries[i];
+                if (Entry.Object == nullptr || !Entry.Owner->IsActive() || !Entry.Object->IsActive()) {
+                    continue;
+                }
+                const auto Dependencies = Entry.Object->GetTickDependencies();
+                if (!Dependencies.IsParallel() || Entry.Object->OnTick.Count() > 0 ||
+                    Entry.Object->OnLateTick.Count() > 0) {
+                    break;
+                }
+
+                // Reading other actors conflicts with writes from other owners, and vice versa
+                const bool ReadsWorld = HasTickAccess(Dependencies.Reads, TickAccess::WORLD);
+                const bool WritesOwner = HasTickAccess(Dependencies.Writes, TickAccess::OWNER);
+                if ((ReadsWorld && Writer != nullptr && (ManyWriters || Writer != Entry.Owner)) ||
+                    (WritesOwner && Reader != nullptr && (ManyReaders || Reader != Entry.Owner))) {
+                    break;
+                }
+
+                // Throttled components skip this tick without joining the batch
+                double DeltaTime;
+                if (!ConsumeTick(Entry.Object->Throttle, Entry.Owner, Phase, DeltaTime)) {
+                    continue;
+                }
+                if (ReadsWorld) {
+                    ManyReaders = ManyReaders || (Reader != nullptr && Reader != Entry.Owner);
+                    Reader = Entry.Owner;
+                }
+                if (WritesOwner) {
+                    ManyWriters = ManyWriters || (Writer != nullptr && Writer != Entry.Owner);
+                    Writer = Entry.Owner;
+                }
+                ParallelBatch.push_back({Entry.Object, Entry.Owner, DeltaTime});
+            }
+
+            // Group the batch by owning actor in spawn order so each actor's components tick in order on one thread
+            std::stable_sort(ParallelBatch.begin(), ParallelBatch.end(),
+                             [](const ParallelEntry &Left, const ParallelEntry &Right) {
+                                 return Left.Owner->SpawnOrder < Right.Owner->SpawnOrder;
+                             });
+            ParallelGroups.clear();
+            for (size_t j = 0; j < ParallelBatch.size(); ++j) {
+                if (j == 0 || ParallelBatch[j].Owner != ParallelBatch[j - 1].Owner) {
+                    ParallelGroups.push_back(static_cast<int>(j));
+                }
+            }
+            ParallelGroups.push_back(static_cast<int>(ParallelBatch.size()));
+
+            // Tick each group on the workers
+            Workers->ParallelFor(static_cast<int>(ParallelGroups.size()) - 1, [&](const int Group) {
+                for (int j = ParallelGroups[Group]; j < ParallelGroups[Group + 1]; ++j) {
+                    TickComponent(ParallelBatch[j].Object, Phase, ParallelBatch[j].DeltaTime);
+                }
+            });
         }
+    }
 
-        // Call cleanup events
-        Cleanup();
-        Cleanup.Clear();
+    // Registers the given started actor to each of its tick phases.
+    void World::RegisterTickPhases(Actor *RegisteredActor) {
+        UnregisterTickPhases(RegisteredActor);
+        TickPhase Phases = RegisteredActor->GetTickPhases();
+        RegisteredActor->Throttle.Reset(RegisteredActor->GetTickRate(),
+                                        static_cast<unsigned int>(RegisteredActor->SpawnOrder));
 
-        ++TotalTicks;
+        // Bound tick events are called once each tick unless they are already called each fixed step
+        if (RegisteredActor->OnTick.Count() > 0 && !HasTickPhase(Phases, TickPhase::FIXED_TICK)) {
+            Phases = Phases | TickPhase::TICK;
+        }
+        if (RegisteredActor->OnLateTick.Count() > 0 && !HasTickPhase(Phases, TickPhase::FIXED_LATE_TICK)) {
+            Phases = Phases | TickPhase::LATE_TICK;
+        }
+        for (int i = 0; i < TICK_PHASE_COUNT; ++i) {
+            if (HasTickPhase(Phases, static_cast<TickPhase>(1 << i))) {
+                RegisteredActor->TickIndices[i] = static_cast<int>(TickingActors[i].size());
+                TickingActors[i].push_back(RegisteredActor);
+            }
+        }
     }
 
-    // Returns the first actor of the given type by name
+    // Registers the given started component to each of its tick phases.
+    void World::RegisterTickPhases(Component *RegisteredComponent) {
+        UnregisterTickPhases(RegisteredComponent);
+        TickPhase Phases = RegisteredComponent->GetTickPhases();
+        RegisteredComponent->Throttle.Reset(RegisteredComponent->GetTickRate(),
+                                            static_cast<unsigned int>(RegisteredComponent->AttachOrder));
+
+        // Bound tick events are called once each tick unless they are already called each fixed step
+        if (RegisteredComponent->OnTick.Count() > 0 && !HasTickPhase(Phases, TickPhase::FIXED_TICK)) {
+            Phases = Phases | TickPhase::TICK;
+        }
+        if (RegisteredComponent->OnLateTick.Count() > 0 && !HasTickPhase(Phases, TickPhase::FIXED_LATE_TICK)) {
+            Phases = Phases | TickPhase::LATE_TICK;
+        }
+        const auto Owner = static_cast<Actor *>(RegisteredComponent->GetActor());
+        for (int i = 0; i < TICK_PHASE_COUNT; ++i) {
+            if (HasTickPhase(Phases, static_cast<TickPhase>(1 << i))) {
+                RegisteredComponent->TickIndices[i] = static_cast<int>(TickingComponents[i].size());
+                TickingComponents[i].push_back({RegisteredComponent, Owner});
+            }
+        }
+    }
+
+    // Removes the given actor from each pending and tick phase list.
+    void World::UnregisterTickPhases(Actor *UnregisteredActor) {
+        std::replace(SpawningActors.begin(), SpawningActors.end(), UnregisteredActor, static_cast<Actor *>(nullptr));
+        std::replace(StartingActors.begin(), StartingActors.end(), UnregisteredActor, static_cast<Actor *>(nullptr));
+        for (int i = 0; i < TICK_PHASE_COUNT; ++i) {
+            if (UnregisteredActor->TickIndices[i] != -1) {
+                TickingActors[i][UnregisteredActor->TickIndices[i]] = nullptr;
+                UnregisteredActor->TickIndices[i] = -1;
+                TickPhasesDirty = true;
+            }
+        }
+    }
+
+    // Removes the given component from each pending and tick phase list.
+    void World::UnregisterTickPhases(Component *UnregisteredComponent) {
+        for (auto &Entry: AttachingComponents) {
+            if (Entry.Object == UnregisteredComponent) {
+                Entry.Object = nullptr;
+            }
+        }
+        for (auto &Entry: StartingComponents) {
+            if (Entry.Object == UnregisteredComponent) {
+                Entry.Object = nullptr;
+            }
+        }
+        for (int i = 0; i < TICK_PHASE_COUNT; ++i) {
+            if (UnregisteredComponent->TickIndices[i] != -1) {
+                TickingComponents[i][UnregisteredComponent->TickIndices[i]].Object = nullptr;
+                UnregisteredComponent->TickIndices[i] = -1;
+                TickPhasesDirty = true;
+            }
+        }
+    }
+
+    // Removes unregistered entries from each tick phase list while preserving their order.
+    void World::CompactTickPhases() {
+        if (!TickPhasesDirty) {
+            return;
+        }
+        PROFILE_ZONE("World::CompactTickPhases");
+        for (int i = 0; i < TICK_PHASE_COUNT; ++i) {
+            int Count = 0;
+            for (const auto Actor: TickingActors[i]) {
+                if (Actor != nullptr) {
+                    Actor->TickIndices[i] = Count;
+                    TickingActors[i][Count++] = Actor;
+                }
+            }
+            TickingActors[i].resize(Count);
+
+            Count = 0;
+            for (const auto &Entry: TickingComponents[i]) {
+                if (Entry.Object != nullptr) {
+                    Entry.Object->TickIndices[i] = Count;
+                    TickingComponents[i][Count++] = Entry;
+                }
+            }
+            TickingComponents[i].resize(Count);
+        }
+        TickPhasesDirty = false;
+    }
+
+    // Returns an actor that matches the given name
     // or nullptr if it does not exist in this world.
     Reference<Actor> World::GetActor(const std::string &Name) const {
-        for (auto &Actor: Actors) {
-            if (Actor->Name == Name) {
-                return Actor;
+        return FindIndexedActor(ActorsByName, &Actor::Name, Name, [](const Actor *) { return true; });
+    }
+
+    // Returns an actor that matches the given tag
+    // or nullptr if it does not exist in this world.
+    Reference<Actor> World::GetActorWithTag(const std::string &Tag) const {
+        return FindIndexedActor(ActorsByTag, &Actor::Tag, Tag, [](const Actor *) { return true; });
+    }
+
+    // INDEXES
+
+    // Adds the given actor to the given index at the given key and stores its position in the given slot.
+    void World::AddToIndex(std::unordered_map<std::string, std::vector<Actor *> > &Index,
+                           const std::string &Key, Actor *IndexedActor, const int &Slot) {
+        auto &Bucket = Index[Key];
+        IndexedActor->IndexPositions[Slot] = static_cast<int>(Bucket.size());
+        Bucket.push_back(IndexedActor);
+    }
+
+    // Removes the given actor from the given index at the given key using its position in the given slot.
+    void World::RemoveFromIndex(std::unordered_map<std::string, std::vector<Actor *> > &Index,
+                                const std::string &Key, Actor *IndexedActor, const int &Slot) {
+        const auto Found = Index.find(Key);
+        const int Position = IndexedActor->IndexPositions[Slot];
+        if (Found == Index.end() || Position < 0) {
+            return;
+        }
+        auto &Bucket = Found->second;
+        Bucket[Position] = Bucket.back();
+        Bucket[Position]->IndexPositions[Slot] = Position;
+        Bucket.pop_back();
+        IndexedActor->IndexPositions[Slot] = -1;
+        if (Bucket.empty()) {
+            Index.erase(Found);
+        }
+    }
+
+    // Adds the given actor to this world's name, tag and type indexes.
+    void World::IndexActor(Actor *IndexedActor) {
+        IndexedActor->IndexedName = IndexedActor->Name;
+        IndexedActor->IndexedTag = IndexedActor->Tag;
+        AddToIndex(ActorsByName, IndexedActor->IndexedName, IndexedActor, 0);
+        AddToIndex(ActorsByTag, IndexedActor->IndexedTag, IndexedActor, 1);
+        auto &Bucket = ActorsByType[typeid(*IndexedActor)];
+        IndexedActor->IndexPositions[2] = static_cast<int>(Bucket.size());
+        Bucket.push_back(IndexedActor);
+    }
+
+    // Removes the given actor from this world's name, tag and type indexes.
+    void World::UnindexActor(Actor *UnindexedActor) {
+        RemoveFromIndex(ActorsByName, UnindexedActor->IndexedName, UnindexedActor, 0);
+        RemoveFromIndex(ActorsByTag, UnindexedActor->IndexedTag, UnindexedActor, 1);
+        const auto Found = ActorsByType.find(typeid(*UnindexedActor));
+        const int Position = UnindexedActor->IndexPositions[2];
+        if (Found == ActorsByType.end() || Position < 0) {
+            return;
+        }
+        auto &Bucket = Found->second;
+        Bucket[Position] = Bucket.back();
+        Bucket[Position]->IndexPositions[2] = Position;
+        Bucket.pop_back();
+        UnindexedActor->IndexPositions[2] = -1;
+        if (Bucket.empty()) {
+            ActorsByType.erase(Found);
+        }
+    }
+
+    // Moves each actor whose name or tag has changed since it was indexed.
+    // Returns whether any actor was moved.
+    bool World::ReindexActors() const {
+        bool Moved = false;
+        for (const auto List: {&Actors, &PendingActors}) {
+            for (const auto &Actor: *List) {
+                if (Actor->Name != Actor->IndexedName) {
+                    RemoveFromIndex(ActorsByName, Actor->IndexedName, Actor.get(), 0);
+                    Actor->IndexedName = Actor->Name;
+                    AddToIndex(ActorsByName, Actor->IndexedName, Actor.get(), 0);
+                    Moved = true;
+                }
+                if (Actor->Tag != Actor->IndexedTag) {
+                    RemoveFromIndex(ActorsByTag, Actor->IndexedTag, Actor.get(), 1);
+                    Actor->IndexedTag = Actor->Tag;
+                    AddToIndex(ActorsByTag, Actor->IndexedTag, Actor.get(), 1);
+                    Moved = true;
+                }
             }
         }
-        return nullref;
+        return Moved;
+    }
+
+    // STORAGE
+
+    // Returns how this world stores and iterates its components.
+    ComponentStorage World::GetStorage() const {
+        return Storage;
+    }
+
+    // Sets how this world stores and iterates its components.
+    // NOTE: This must be set before any actors are spawned in this world.
+    void World::SetStorage(const ComponentStorage &Storage) {
+        if (this->Storage == Storage) {
+            return;
+        }
+        if (!Actors.empty()) {
+            throw std::runtime_error(
+                std::string("ERROR: Cannot change the component storage of world \"") + Name +
+                "\" after actors have been spawned!");
+        }
+        this->Storage = Storage;
     }
 
     // EVENTS
@@ -345,5 +1261,5 @@ namespace FureyEngine {
     // STATIC VARIABLE INITIALIZATION
 
     // The total number of worlds currently allocated.
-    int World::TotalWorlds;
+    std::atomic<int> World::TotalWorlds = 0;
 }
@@ -4,6 +4,16 @@
 
 #pragma once
 #include "../Actors/Actor.h"
+#include "../ActorPool/ActorPool.h"
+#include "../CommandBuffer/CommandBuffer.h"
+#include "../ComponentTable/ComponentTable.h"
+#include "../Coroutine/Coroutine.h"
+#include "../EventBus/EventBus.h"
+#include "../PoolAllocator/PoolAllocator.h"
+#include "../Profiler/Profiler.h"
+#include "../Random/Random.h"
+#include "../ThreadPool/ThreadPool.h"
+#include "../TimerWheel/TimerWheel.h"
 
 namespace FureyEngine {
     /**
@@ -11,6 +21,11 @@ namespace FureyEngine {
      * Inherit from this class to create new custom worlds each with their own actors.
      */
     class World : public std::enable_shared_from_this<World> {
+        // REFERENCE
+
+        /** This world's handle in the reference registry, which is released after every other member. */
+        ReferenceSlot MySlot;
+
         // TIME
 
         /** The time point of this world when it was loaded. */
@@ -25,26 +40,241 @@ namespace FureyEngine {
         /** The total number of ticks called of this world. */
         unsigned long long TotalTicks = 0;
 
-        /** An event that is automatically invoked after a specific time. */
-        struct TimedEvent final {
-            // TIME
+        /** Functions scheduled to be invoked after a specific time. */
+        TimerWheel ScheduledEvents;
+
+        /** Coroutines started in this world, which are resumed after scheduled events. */
+        CoroutineScheduler Coroutines;
+
+        // DETERMINISM
+
+        /** The delta time each tick advances by instead of the elapsed real time, or 0 to use the elapsed real time. */
+        double DeterministicDeltaTime = 0;
+
+        /** This world's random number generator. */
+        Random MyRandom;
+
+        /** The number of actors and components added to this world, which orders them without using their addresses. */
+        unsigned long long SpawnedObjects = 0;
 
-            /** The remaining time before invoking this function. */
-            double Delay = 0;
+        // FIXED TIME STEP
+
+        /** The time in seconds between each fixed simulation step, or 0 to simulate once each tick. */
+        double FixedTimeStep = 0;
+
+        /** The time in seconds that has not been simulated by a fixed step yet. */
+        double FixedAccumulator = 0;
+
+        /** How far this world is between its last two fixed simulation steps, from 0 to 1. */
+        double Interpolation = 1;
+
+        /**
+         * Calls fixed tick events once for each whole fixed simulation step that has elapsed.<br/>
+         * Without a fixed time step, fixed tick events are called once with the current delta time.
+         */
+        void SimulateFixedSteps();
 
-            // EVENT
+        /** Calls fixed tick and fixed late tick events on each registered actor and component. */
+        void TickFixedPhases();
 
-            /** The one time event to invoke after the delay reaches 0. */
-            std::function<void()> Event = nullptr;
+        // STORAGE
 
-            // INVOKED
+        /** How this world stores and iterates its components. */
+        ComponentStorage Storage = ComponentStorage::ACTOR_LISTS;
 
-            /** Whether this time event has been invoked yet. */
-            bool Invoked = false;
+        /** Each component table in this world in the order they were created. */
+        std::vector<std::shared_ptr<ComponentTableBase> > ComponentTables;
+
+        /** Each component table in this world by component type. */
+        std::unordered_map<std::type_index, ComponentTableBase *> ComponentTablesByType;
+
+        // TICK PHASES
+
+        /** A component and its owning actor registered with this world. */
+        struct ComponentEntry final {
+            /** The registered component. */
+            Component *Object = nullptr;
+
+            /** The component's owning actor. */
+            Actor *Owner = nullptr;
         };
 
-        /** Events to call when they are scheduled. */
-        std::list<TimedEvent> ScheduledEvents;
+        /** Each actor waiting for its spawn events in the order they were spawned. */
+        std::vector<Actor *> SpawningActors;
+
+        /** Each actor that has spawned and is waiting for its start events. */
+        std::vector<Actor *> StartingActors;
+
+        /** Each component waiting for its attach events in the order they were attached. */
+        std::vector<ComponentEntry> AttachingComponents;
+
+        /** Each component that has attached and is waiting for its start events. */
+        std::vector<ComponentEntry> StartingComponents;
+
+        /** Each started actor registered to each tick phase, with nullptr marking unregistered actors. */
+        std::vector<Actor *> TickingActors[TICK_PHASE_COUNT];
+
+        /** Each started component registered to each tick phase, with nullptr marking unregistered components. */
+        std::vector<ComponentEntry> TickingComponents[TICK_PHASE_COUNT];
+
+        /** Whether any tick phase list contains unregistered entries that need to be removed. */
+        bool TickPhasesDirty = false;
+
+        /** Registers the given started actor to each of its tick phases. */
+        void RegisterTickPhases(Actor *RegisteredActor);
+
+        /** Registers the given started component to each of its tick phases. */
+        void RegisterTickPhases(Component *RegisteredComponent);
+
+        /** Removes the given actor from each pending and tick phase list. */
+        void UnregisterTickPhases(Actor *UnregisteredActor);
+
+        /** Removes the given component from each pending and tick phase list. */
+        void UnregisterTickPhases(Component *UnregisteredComponent);
+
+        /** Removes unregistered entries from each tick phase list while preserving their order. */
+        void CompactTickPhases();
+
+        /** A parallel component gathered into the batch currently being ticked. */
+        struct ParallelEntry final {
+            /** The gathered component. */
+            Component *Object = nullptr;
+
+            /** The component's owning actor. */
+            Actor *Owner = nullptr;
+
+            /** The delta time the component ticks with. */
+            double DeltaTime = 0;
+        };
+
+        /** Each parallel component gathered into the batch currently being ticked. */
+        std::vector<ParallelEntry> ParallelBatch;
+
+        /** The first index of each owning actor's components in the current parallel batch, followed by its size. */
+        std::vector<int> ParallelGroups;
+
+        /**
+         * Calls tick or late tick events on the given component.<br/>
+         * Even phases call tick events and odd phases call late tick events.
+         */
+        void TickComponent(Component *TickedComponent, const int &Phase, const double &DeltaTime) const;
+
+        /**
+         * Returns whether an object with the given throttle and owning actor should tick in the given phase.<br/>
+         * Fixed phases always tick. Otherwise the delta time accumulated since the object's last tick<br/>
+         * is written to the given output once its tick rate at its owner's current relevance has elapsed.
+         */
+        bool ConsumeTick(TickThrottle &Throttle, Actor *Owner, const int &Phase, double &DeltaTime) const;
+
+        /**
+         * Calls each registered component's events for the given tick phase.<br/>
+         * Components with parallel tick dependencies are batched and ticked across this world's workers.
+         */
+        void TickComponents(const int &Phase);
+
+        /**
+         * Calls spawn and attach events on each pending actor and component, then tick events on each registered one.<br/>
+         * Actors spawned and components attached by spawn events are spawned and attached on this update too.<br/>
+         * Every registered actor ticks before every registered component.
+         */
+        void TickActors();
+
+        /** Calls late tick events on each registered actor and component, then start events on each pending one. */
+        void LateTickActors();
+
+        /** Actors register their components' tick phases. */
+        friend class Actor;
+
+        /** Components register their own tick phases. */
+        friend class Component;
+
+        // COMMANDS
+
+        /** Each structural change recorded since this world's last sync point. */
+        CommandBuffer Commands;
+
+        /** Each spawned actor waiting for its spawn command to move it into this world's actor list. */
+        std::list<std::shared_ptr<Actor> > PendingActors;
+
+        /** Applies each recorded command up to and including the given kind in order of their kind. */
+        void ApplyCommands(const CommandType &Last);
+
+        /** Applies the given recorded command of the given kind if its object still exists. */
+        void ApplyCommand(const CommandType &Type, const Command &Applied);
+
+        // ACTOR POOLS
+
+        /** Each actor pool in this world by actor type. */
+        std::unordered_map<std::type_index, std::shared_ptr<ActorPoolBase> > ActorPools;
+
+        /** Calls destroy events on the given pooled actor and its components, then moves it into its pool. */
+        void ReturnToPool(Actor *PooledActor);
+
+        /** Moves the given pooled actor back into this world and queues it and its components to spawn again. */
+        void ReactivateFromPool(Actor *PooledActor, const Transform &Transform);
+
+        /** Actor pools spawn and reactivate their actors. */
+        template<typename ActorType>
+        friend class ActorPool;
+
+        // COROUTINES
+
+        /** Stops each coroutine owned by the given destroyed actor so none of them wait to be resumed. */
+        void StopOwnedCoroutines(Actor *DestroyedActor);
+
+        // INDEXES
+
+        /** Each actor in this world by the name it was last indexed with. */
+        mutable std::unordered_map<std::string, std::vector<Actor *> > ActorsByName;
+
+        /** Each actor in this world by the tag it was last indexed with. */
+        mutable std::unordered_map<std::string, std::vector<Actor *> > ActorsByTag;
+
+        /** Each actor in this world by its type. */
+        std::unordered_map<std::type_index, std::vector<Actor *> > ActorsByType;
+
+        /** Adds the given actor to the given index at the given key and stores its position in the given slot. */
+        static void AddToIndex(std::unordered_map<std::string, std::vector<Actor *> > &Index,
+                               const std::string &Key, Actor *IndexedActor, const int &Slot);
+
+        /** Removes the given actor from the given index at the given key using its position in the given slot. */
+        static void RemoveFromIndex(std::unordered_map<std::string, std::vector<Actor *> > &Index,
+                                    const std::string &Key, Actor *IndexedActor, const int &Slot);
+
+        /** Adds the given actor to this world's name, tag and type indexes. */
+        void IndexActor(Actor *IndexedActor);
+
+        /** Removes the given actor from this world's name, tag and type indexes. */
+        void UnindexActor(Actor *UnindexedActor);
+
+        /**
+         * Moves each actor whose name or tag has changed since it was indexed.<br/>
+         * Returns whether any actor was moved.
+         */
+        bool ReindexActors() const;
+
+        /**
+         * Returns the first indexed actor whose given field matches the given key and satisfies the given condition.<br/>
+         * Actors renamed or retagged since they were indexed are indexed again before giving up.
+         */
+        template<typename ConditionType>
+        Actor *FindIndexedActor(std::unordered_map<std::string, std::vector<Actor *> > &Index,
+                                std::string Actor::*Field, const std::string &Key, ConditionType Condition) const {
+            for (int Attempt = 0; Attempt < 2; ++Attempt) {
+                const auto Found = Index.find(Key);
+                if (Found != Index.end()) {
+                    for (const auto Actor: Found->second) {
+                        if (Actor->*Field == Key && Condition(Actor)) {
+                            return Actor;
+                        }
+                    }
+                }
+                if (!ReindexActors()) {
+                    break;
+                }
+            }
+            return nullptr;
+        }
 
         // ACTIVITY
 
@@ -54,7 +284,7 @@ namespace FureyEngine {
         // TOTAL WORLDS
 
         /** The total number of worlds currently allocated. */
-        static int TotalWorlds;
+        static std::atomic<int> TotalWorlds;
 
     public:
         // WORLD SETTINGS
@@ -68,11 +298,40 @@ namespace FureyEngine {
         /** Whether tick should be called over start. */
         bool BeginTick = false;
 
+        /**
+         * Whether this world shares no actors or state with other worlds, so Engine::UpdateWorlds()<br/>
+         * may update it on a worker thread at the same time as other isolated worlds.<br/>
+         * NOTE: Isolated worlds must not use engine-wide state such as input, controllers, resources, renderers,<br/>
+         * audio, OpenGL or Engine::Cleanup while updating.
+         */
+        bool Isolated = false;
+
         // TIME
 
         /** The scale applied to delta time in this world. */
         double TimeScale = 1;
 
+        /** The maximum number of fixed simulation steps called in a single tick before the remaining time is dropped. */
+        int MaxFixedSteps = 8;
+
+        // WORKERS
+
+        /**
+         * The worker threads used to tick components that declare parallel tick dependencies.<br/>
+         * Components without declared dependencies always tick serially on the thread calling Update().<br/>
+         * Set this to nullptr to tick every component serially.
+         */
+        std::shared_ptr<ThreadPool> Workers = nullptr;
+
+        // RELEVANCE
+
+        /**
+         * Returns how relevant the given actor is, which throttles actors and components with a relevant tick rate.<br/>
+         * Assign CameraComponent::RelevancePolicy() to throttle by distance from a camera's view.<br/>
+         * Set this to nullptr to treat every actor as visible.
+         */
+        std::function<TickRelevance(const Actor *)> RelevancePolicy = nullptr;
+
         // ACTORS
 
         /** Each actor instance currently in this world. */
@@ -116,6 +375,14 @@ namespace FureyEngine {
          */
         Delegate<const bool &> OnSetActive;
 
+        // EVENT BUS
+
+        /**
+         * This world's typed events used to message between actors.<br/>
+         * Events published to this bus are dispatched in batches after actors tick and after actors late tick.
+         */
+        EventBus Bus;
+
         // CLEANUP
 
         /**
@@ -148,6 +415,11 @@ namespace FureyEngine {
         /** Properly destroys this world. */
         virtual ~World();
 
+        // REFERENCE
+
+        /** Returns this world's handle in the reference registry. */
+        [[nodiscard]] const ReferenceHandle &GetHandle() const;
+
         // TIME
 
         /** Returns the time point this world was created. */
@@ -165,124 +437,343 @@ namespace FureyEngine {
         /** Returns the total number of times Tick() has been called for this world. */
         [[nodiscard]] unsigned long long TickCount() const;
 
+        /** Returns the time in seconds between each fixed simulation step, or 0 if this world simulates each tick. */
+        [[nodiscard]] double GetFixedTimeStep() const;
+
+        /**
+         * Sets the time in seconds between each fixed simulation step, or 0 to simulate once each tick.<br/>
+         * Physics, movement and collision components tick once per fixed step,<br/>
+         * and rendered actors are interpolated between their last two fixed steps.<br/>
+         * Each started actor and component is registered again with its new tick phases.
+         */
+        void SetFixedTimeStep(const double &FixedTimeStep);
+
+        /** Returns how far this world is between its last two fixed simulation steps, from 0 to 1. */
+        [[nodiscard]] const double &GetInterpolation() const;
+
         /**
          * Invokes the given function after the given number of seconds.<br/>
-         * Returns the scheduled event.
+         * Returns a handle that cancels the scheduled event when passed to CancelInvoke().
          */
-        TimedEvent *InvokeAfterSeconds(double Delay,
+        TimerHandle InvokeAfterSeconds(double Delay,
                                        const std::function<void()> &Function);
 
         /**
          * Invokes the given function after the given number of seconds for the given number of loops.<br/>
          * If loops is equal to -1, it will loop forever.<br/>
-         * Returns the scheduled event.
+         * Returns a handle that cancels the scheduled event when passed to CancelInvoke().
          */
-        TimedEvent *RepeatAfterSeconds(double Delay,
+        TimerHandle RepeatAfterSeconds(double Delay,
                                        const int &Loops,
                                        const std::function<void()> &Function);
 
         /**
          * Invokes the given function after the given number of seconds for the given number of loops.<br/>
          * This function will loop forever unless cancelled.<br/>
-         * Returns the scheduled event.
+         * Returns a handle that cancels the scheduled event when passed to CancelInvoke().
          */
-        TimedEvent *RepeatAfterSeconds(const double &Delay,
+        TimerHandle RepeatAfterSeconds(const double &Delay,
                                        const std::function<void()> &Function);
 
         /**
          * Invokes the given function the following tick.<br/>
-         * Returns the scheduled event.
+         * Returns a handle that cancels the scheduled event when passed to CancelInvoke().
          */
-        TimedEvent *InvokeNextTick(const std::function<void()> &Function);
+        TimerHandle InvokeNextTick(const std::function<void()> &Function);
 
         /**
-         * Attempt to unschedule the given function from the scheduled events.<br/>
+         * Attempt to unschedule the scheduled event with the given handle.<br/>
          * Returns if the cancellation was successful.
          */
-        bool CancelInvoke(const std::function<void()> &Function);
+        bool CancelInvoke(const TimerHandle &Handle);
+
+        /** Returns whether the scheduled event with the given handle has not been invoked or cancelled yet. */
+        [[nodiscard]] bool IsInvokeScheduled(const TimerHandle &Handle) const;
+
+        // COROUTINES
+
+        /**
+         * Starts the given coroutine, which runs until it first co_awaits Seconds(), NextTick() or NextInvoke().<br/>
+         * It is then resumed once its wait is over, after this world's scheduled events.<br/>
+         * If an owner is given, the coroutine is stopped as soon as its owner is destroyed or returned to its pool.<br/>
+         * Returns a handle that stops the coroutine when passed to StopCoroutine().
+         */
+        CoroutineHandle StartCoroutine(Coroutine Script, const Reference<Actor> &Owner = nullref);
+
+        /**
+         * Stops the coroutine with the given handle, destroying each of its local variables.<br/>
+         * Returns if the coroutine was still running.
+         */
+        bool StopCoroutine(const CoroutineHandle &Handle);
+
+        /** Returns whether the coroutine with the given handle has not finished or been stopped yet. */
+        [[nodiscard]] bool IsCoroutineRunning(const CoroutineHandle &Handle) const;
+
+        /** Returns the number of coroutines running in this world. */
+        [[nodiscard]] int CoroutineCount() const;
+
+        // DETERMINISM
+
+        /** Returns whether this world advances by a set delta time each tick instead of the elapsed real time. */
+        [[nodiscard]] bool IsDeterministic() const;
+
+        /**
+         * Makes this world advance by exactly the given delta time each tick instead of the elapsed real time,<br/>
+         * and reseeds its random number generator with the given seed.<br/>
+         * Two runs with the same seed and inputs then produce identical state if actors only use GetRandom().<br/>
+         * Call this before this world's first update so its elapsed time also starts from 0.<br/>
+         * Pass a delta time of 0 to use the elapsed real time again.
+         */
+        void SetDeterministic(const double &TickDeltaTime, const unsigned long long &Seed = 0);
+
+        /**
+         * Returns this world's random number generator, which is reseeded by SetDeterministic().<br/>
+         * NOTE: This must not be used by components ticking in parallel since the order they draw numbers in is not fixed.
+         */
+        [[nodiscard]] Random &GetRandom();
+
+        // SNAPSHOTS
+
+        /**
+         * Saves this world's time, random number generator, scheduled events, and each actor and component<br/>
+         * of a type registered with Snapshot::RegisterActor() or Snapshot::RegisterComponent() into a snapshot.<br/>
+         * NOTE: This must be called between updates.
+         */
+        [[nodiscard]] Snapshot SaveSnapshot() const;
+
+        /**
+         * Destroys each actor in this world and restores the state saved in the given snapshot.<br/>
+         * Restored actors and components call their spawn, attach and start events again on the next update.<br/>
+         * Coroutines cannot be saved, so each running coroutine is stopped.<br/>
+         * NOTE: This must be called between updates.
+         */
+        void LoadSnapshot(const Snapshot &Loaded);
 
         // ACTORS
 
         /**
          * Updates the current state of this world and its actors.<br/>
+         * Each phase ticks every registered actor, then every registered component,<br/>
+         * rather than ticking each actor's components right after it.<br/>
          * Call this in each update loop.
          */
         void Update();
 
-        /** Spawns a new actor of the given class in this world. */
+        /**
+         * Spawns a new actor of the given class in this world.<br/>
+         * The actor and its control block are allocated together from the size class pool of their size.<br/>
+         * The actor is indexed immediately, and is moved into Actors before actors next tick.<br/>
+         * Actors spawned while actors are ticking are spawned and started on the following update.<br/>
+         * Actors spawned by spawn events are spawned and started on the same update.
+         */
         template<typename ActorType, typename... ArgumentTypes>
         Reference<ActorType> SpawnActor(const Transform &Transform, ArgumentTypes... Arguments) {
-            const auto Actor = new ActorType(Arguments...);
-            Actors.emplace_back(Actor);
+            PendingActors.push_back(std::allocate_shared<ActorType>(PoolAllocator<ActorType>(), Arguments...));
+            const auto Actor = static_cast<ActorType *>(PendingActors.back().get());
+            Actor->WorldIterator = std::prev(PendingActors.end());
             Actor->SetWorld(shared_from_this());
             Actor->Transform = Transform;
-            return std::dynamic_pointer_cast<ActorType>(Actors.back());
+            Actor->PreviousTransform = Transform;
+            Commands.Record(CommandType::SPAWN, Actor, nullptr, Actor->GetHandle());
+            IndexActor(Actor);
+            return Actor;
+        }
+
+        /**
+         * Spawns a new actor of the given class in this world at each of the given transforms.<br/>
+         * Each actor is constructed with the given arguments within a single block of memory,<br/>
+         * which is freed once every actor in the batch has been destroyed.<br/>
+         * Each actor still has its own pooled control block and actor list node.<br/>
+         * Components attached by spawn events, and any brushes or renderers they register, are still allocated and
+         * registered one at a time.<br/>
+         * The given function is called with each actor and its index before any of their events are called.
+         */
+        template<typename ActorType, typename... ArgumentTypes>
+        std::vector<Reference<ActorType> > SpawnActors(const std::span<const Transform> &Transforms,
+                                                       const std::function<void(ActorType *, const int &)> &
+                                                       Initialize = nullptr,
+                                                       ArgumentTypes... Arguments) {
+            const int Count = static_cast<int>(Transforms.size());
+            std::vector<Reference<ActorType> > Spawned;
+            if (Count == 0) {
+                return Spawned;
+            }
+            Spawned.reserve(Count);
+            auto &SpawnCommands = Commands.Commands[static_cast<int>(CommandType::SPAWN)];
+            SpawnCommands.reserve(SpawnCommands.size() + Count);
+
+            // Allocate memory for every actor at once
+            ActorType *const Block = std::allocator<ActorType>().allocate(Count);
+            const auto Memory = std::shared_ptr<void>(static_cast<void *>(Block), [Count](void *Freed) {
+                std::allocator<ActorType>().deallocate(static_cast<ActorType *>(Freed), Count);
+            });
+
+            const auto Self = shared_from_this();
+            for (int i = 0; i < Count; ++i) {
+                // Each actor keeps the block alive until it is destroyed
+                const auto Actor = new(Block + i) ActorType(Arguments...);
+                PendingActors.emplace_back(Actor, [Memory](ActorType *Destroyed) { Destroyed->~ActorType(); },
+                                           PoolAllocator<ActorType>());
+                Actor->WorldIterator = std::prev(PendingActors.end());
+                Actor->SetWorld(Self);
+                Actor->Transform = Transforms[i];
+                Actor->PreviousTransform = Transforms[i];
+                Commands.Record(CommandType::SPAWN, Actor, nullptr, Actor->GetHandle());
+                IndexActor(Actor);
+                Spawned.emplace_back(Actor);
+            }
+
+            // Initialize each actor once the whole batch exists
+            if (Initialize != nullptr) {
+                for (int i = 0; i < Count; ++i) {
+                    Initialize(Spawned[i].Get(), i);
+                }
+            }
+            return Spawned;
         }
 
-        /** Destroys the given actor at the end of the tick, and returns whether it was successfully found. */
+        /**
+         * Destroys the given actor at the end of the tick, and returns whether it was successfully found.<br/>
+         * Pooled actors keep their components and are returned to their pool instead of being freed.
+         */
         template<typename ActorType>
         bool DestroyActor(const ActorType *DestroyedActor) {
-            if (DestroyedActor == nullptr) {
+            if (DestroyedActor == nullptr || !ReferenceRegistry::IsValid(DestroyedActor->GetHandle()) ||
+                DestroyedActor->GetWorld().Get() != this) {
                 return false;
             }
 
-            for (auto &Actor: Actors) {
-                if (Actor.get() == DestroyedActor) {
-                    // Remove all of this actor's components
-                    for (const auto &Component: Actor->Components) {
-                        Actor->RemoveComponent(Component.get());
-                    }
+            const auto Actor = const_cast<FureyEngine::Actor *>(static_cast<const FureyEngine::Actor *>(DestroyedActor));
 
-                    Cleanup.Bind([&] {
-                        if (Actor == nullptr) {
-                            return;
-                        }
-
-                        // Call destroy events
-                        Actor->Destroy();
-                        Actor->OnDestroy(Actor.get());
-
-                        // Delete this actor
-                        Actors.remove(Actor);
-                    });
-                    return true;
+            // Remove all of this actor's components unless it keeps them in its pool
+            if (Actor->Pool == nullptr) {
+                for (const auto &Component: Actor->Components) {
+                    Actor->RemoveComponent(Component.get());
                 }
             }
-            return false;
+
+            Commands.Record(CommandType::DESTROY, Actor, nullptr, Actor->GetHandle());
+            return true;
         }
 
         /**
-         * Returns the first actor that matches the given name<br/>
+         * Returns an actor that matches the given name<br/>
          * or nullptr if it does not exist in this world.
          */
         [[nodiscard]] Reference<Actor> GetActor(const std::string &Name) const;
 
         /**
-         * Returns the first actor of the given type<br/>
+         * Returns an actor of the given type<br/>
          * or nullptr if it does not exist in this world.
          */
         template<typename ActorType>
         [[nodiscard]] Reference<ActorType> GetActor() const {
-            for (const auto &Actor: Actors) {
-                if (Actor->Is<ActorType>()) {
-                    return std::dynamic_pointer_cast<ActorType>(Actor);
-                }
+            const auto Found = ActorsByType.find(typeid(ActorType));
+            if (Found != ActorsByType.end()) {
+                return static_cast<ActorType *>(Found->second.front());
             }
             return nullref;
         }
 
         /**
-         * Returns the first actor of the given type that matches the given name<br/>
+         * Returns an actor of the given type that matches the given name<br/>
          * or nullptr if it does not exist in this world. 
          */
         template<typename ActorType>
         [[nodiscard]] Reference<ActorType> GetActor(const std::string &Name) const {
-            for (const auto &Actor: Actors) {
-                if (Actor->Name == Name && Actor->Is<ActorType>()) {
-                    return std::dynamic_pointer_cast<ActorType>(Actor);
+            return static_cast<ActorType *>(FindIndexedActor(ActorsByName, &Actor::Name, Name, [](const Actor *Found) {
+                return Found->Is<ActorType>();
+            }));
+        }
+
+        /**
+         * Returns an actor that matches the given tag<br/>
+         * or nullptr if it does not exist in this world.
+         */
+        [[nodiscard]] Reference<Actor> GetActorWithTag(const std::string &Tag) const;
+
+        // COMMANDS
+
+        /** Sets whether the given actor in this world is active at the end of the tick. */
+        void SetActorActive(const Actor *ActivatedActor, const bool &Active);
+
+        /** Sets whether the given component in this world is active at the end of the tick. */
+        void SetComponentActive(const Component *ActivatedComponent, const bool &Active);
+
+        /** Returns each structural change recorded since this world's last sync point. */
+        [[nodiscard]] const CommandBuffer &GetCommands() const;
+
+        /**
+         * Applies each structural change recorded since this world's last sync point in order of their kind.<br/>
+         * Spawns and attaches are applied before actors tick, and every other change at the end of each Update().
+         */
+        void FlushCommands();
+
+        // ACTOR POOLS
+
+        /**
+         * Returns this world's pool of actors of the given type, creating it if it does not exist.<br/>
+         * Actors spawned from a pool are returned to it when destroyed instead of being freed.
+         */
+        template<typename ActorType>
+        ActorPool<ActorType> &GetActorPool() {
+            auto &Pool = ActorPools[typeid(ActorType)];
+            if (Pool == nullptr) {
+                Pool = std::make_shared<ActorPool<ActorType> >(this);
+            }
+            return *static_cast<ActorPool<ActorType> *>(Pool.get());
+        }
+
+        // STORAGE
+
+        /** Returns how this world stores and iterates its components. */
+        [[nodiscard]] ComponentStorage GetStorage() const;
+
+        /**
+         * Sets how this world stores and iterates its components.<br/>
+         * Component tables keep components of the same type in contiguous memory for ForEachComponent(),<br/>
+         * while ticking always goes through this world's tick phase lists.<br/>
+         * NOTE: This must be set before any actors are spawned in this world.
+         */
+        void SetStorage(const ComponentStorage &Storage);
+
+        /** Returns this world's table of components of the given type, creating it if it does not exist. */
+        template<typename ComponentType>
+        ComponentTable<ComponentType> &GetComponentTable() {
+            const auto Found = ComponentTablesByType.find(typeid(ComponentType));
+            if (Found != ComponentTablesByType.end()) {
+                return *static_cast<ComponentTable<ComponentType> *>(Found->second);
+            }
+            const auto Table = std::make_shared<ComponentTable<ComponentType> >();
+            ComponentTables.push_back(Table);
+            ComponentTablesByType[typeid(ComponentType)] = Table.get();
+            return *Table;
+        }
+
+        /**
+         * Calls the given function with each component of the given type in this world.<br/>
+         * When using component tables, components are visited linearly in table order.
+         */
+        template<typename ComponentType, typename FunctionType>
+        void ForEachComponent(FunctionType Function) {
+            if (Storage == ComponentStorage::COMPONENT_TABLES) {
+                const auto Found = ComponentTablesByType.find(typeid(ComponentType));
+                if (Found == ComponentTablesByType.end()) {
+                    return;
+                }
+                const auto Table = Found->second;
+                for (int i = 0; i < Table->Count(); ++i) {
+                    Function(static_cast<ComponentType *>(Table->GetComponent(i)));
+                }
+            } else {
+                for (const auto &Actor: Actors) {
+                    for (const auto &Component: Actor->Components) {
+                        if (Component->template Is<ComponentType>()) {
+                            Function(static_cast<ComponentType *>(Component.get()));
+                        }
+                    }
                 }
             }
-            return nullref;
         }
 
         // EVENTS
@@ -330,4 +821,82 @@ namespace FureyEngine {
          */
         virtual void SetActive(const bool &Active);
     };
+
+    // ACTOR POOLS
+
+    // Spawns an actor of this pool's type in its world, reusing a destroyed actor if one is available.
+    // The given arguments are only used to construct a new actor when the pool is empty.
+    template<typename ActorType>
+    template<typename... ArgumentTypes>
+    Reference<ActorType> ActorPool<ActorType>::Spawn(const Transform &Transform, ArgumentTypes... Arguments) {
+        if (Inactive.empty()) {
+            const auto Spawned = MyWorld->template SpawnActor<ActorType>(Transform, Arguments...);
+            Track(Spawned.Get());
+            return Spawned;
+        }
+        const auto Reused = static_cast<ActorType *>(Inactive.front().get());
+        MyWorld->ReactivateFromPool(Reused, Transform);
+        return Reused;
+    }
+
+    // Allocates destroyed actors until this pool stores at least the given number of them.
+    template<typename ActorType>
+    template<typename... ArgumentTypes>
+    void ActorPool<ActorType>::Reserve(const int &Count, ArgumentTypes... Arguments) {
+        while (Inactive.size() < static_cast<size_t>(Count)) {
+            const auto Actor = std::allocate_shared<ActorType>(PoolAllocator<ActorType>(), Arguments...);
+            Actor->SetWorld(MyWorld->shared_from_this());
+            Store(Actor);
+        }
+    }
+
+    // COMPONENTS
+
+    // Allocates a new component of the given type for the given actor using its world's component storage.
+    template<typename ComponentType, typename... ArgumentTypes>
+    std::shared_ptr<ComponentType> NewComponent(World *OwningWorld, Actor *OwningActor, ArgumentTypes &&... Arguments) {
+        if (OwningWorld == nullptr || OwningWorld->GetStorage() != ComponentStorage::COMPONENT_TABLES) {
+            return std::allocate_shared<ComponentType>(PoolAllocator<ComponentType>(),
+                                                       std::forward<ArgumentTypes>(Arguments)...);
+        }
+        return OwningWorld->GetComponentTable<ComponentType>().New(OwningActor,
+                                                                    std::forward<ArgumentTypes>(Arguments)...);
+    }
+
+    // SNAPSHOTS
+
+    // Registers the given actor type so snapshots save and restore it under the given name.
+    // Restored actors are constructed with the given arguments, then load their saved state.
+    template<typename ActorType, typename... ArgumentTypes>
+    void Snapshot::RegisterActor(const std::string &TypeName, ArgumentTypes... Arguments) {
+        RegisterActorType(typeid(ActorType), {
+                              TypeName, [Arguments...](World *SpawningWorld, const int &Count) {
+                                  const auto Spawned = SpawningWorld->template SpawnActors<ActorType>(
+                                      std::vector<Transform>(Count), nullptr, Arguments...);
+                                  std::vector<Actor *> Actors;
+                                  Actors.reserve(Spawned.size());
+                                  for (const auto &Actor: Spawned) {
+                                      Actors.push_back(Actor.Get());
+                                  }
+                                  return Actors;
+                              }
+                          });
+    }
+
+    // Registers the given component type so snapshots save and restore it under the given name.
+    // Restored components are attached with the given function, or default constructed if it is nullptr,
+    // then load their saved state.
+    template<typename ComponentType>
+    void Snapshot::RegisterComponent(const std::string &TypeName,
+                                     const std::function<Component *(Actor *)> &Attach) {
+        std::function<Component *(Actor *)> Attacher = Attach;
+        if (Attacher == nullptr) {
+            if constexpr (std::is_default_constructible_v<ComponentType>) {
+                Attacher = [](Actor *OwningActor) -> Component * {
+                    return OwningActor->AttachComponent<ComponentType>().Get();
+                };
+            }
+        }
+        RegisterComponentType(typeid(ComponentType), {TypeName, Attacher});
+    }
 }
@@ -0,0 +1,193 @@
+// .cpp
+// Microbenchmark Script
+// by Kyle Furey
+
+#include "Benchmark.h"
+
+namespace FureyEngine {
+    // RESULTS
+
+    // Appends the given text to the given JSON as a string.
+    void Benchmark::AppendString(std::string &Json, const std::string &Text) {
+        Json += '"';
+        for (const char Character: Text) {
+            switch (Character) {
+                case '"':
+                    Json += "\\\"";
+                    break;
+                case '\\':
+                    Json += "\\\\";
+                    break;
+                case '\n':
+                    Json += "\\n";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(Character) >= 0x20) {
+                        Json += Character;
+                    }
+                    break;
+            }
+        }
+        Json += '"';
+    }
+
+    // RUNNING
+
+    // Returns whether the benchmark with the given name passes the filter.
+    bool Benchmark::IsSelected(const std::string &Name) {
+        return Filter.empty() || Name.find(Filter) != std::string::npos;
+    }
+
+    // Times the given sample, which performs the given number of items.
+    // The setup and teardown are called before and after each sample without being timed.
+    // Benchmarks that do not pass the filter are not run.
+    void Benchmark::Run(const std::string &Name,
+                        const long long &Items,
+                        const std::function<void()> &Sample,
+                        const std::function<void()> &Setup,
+                        const std::function<void()> &Teardown) {
+        if (!IsSelected(Name)) {
+            return;
+        }
+        if (Items <= 0 || Samples <= 0) {
+            throw std::runtime_error("ERROR: Benchmark \"" + Name + "\" must perform at least one item and sample!");
+        }
+
+        // Time each sample, discarding the warmup samples
+        std::vector<double> Times;
+        Times.reserve(Samples);
+        for (int i = -WarmupSamples; i < Samples; ++i) {
+            if (Setup != nullptr) {
+                Setup();
+            }
+            const auto Start = std::chrono::steady_clock::now();
+            Sample();
+            const auto End = std::chrono::steady_clock::now();
+            if (Teardown != nullptr) {
+                Teardown();
+            }
+            if (i >= 0) {
+                Times.push_back(std::chrono::duration<double, std::nano>(End - Start).count() /
+                                static_cast<double>(Items));
+            }
+        }
+
+        // Summarize the samples
+        Result Measured;
+        Measured.Name = Name;
+        Measured.Items = Items;
+        Measured.Samples = Samples;
+        std::sort(Times.begin(), Times.end());
+        Measured.Min = Times.front();
+        Measured.Max = Times.back();
+        Measured.Median = Times.size() % 2 == 1
+                              ? Times[Times.size() / 2]
+                              : (Times[Times.size() / 2 - 1] + Times[Times.size() / 2]) / 2;
+        Measured.Mean = std::accumulate(Times.begin(), Times.end(), 0.0) / static_cast<double>(Times.size());
+        double Variance = 0;
+        for (const double Time: Times) {
+            Variance += (Time - Measured.Mean) * (Time - Measured.Mean);
+        }
+        Measured.StandardDeviation = std::sqrt(Variance / static_cast<double>(Times.size()));
+        Results.push_back(Measured);
+
+        // Report progress without interfering with JSON written to the standard output
+        std::cerr << Name << ": " << Measured.Median << " ns per item (median of " << Samples << " samples of "
+                << Items << " items)" << std::endl;
+    }
+
+    // Records that the benchmark with the given name could not be run and why.
+    void Benchmark::Skip(const std::string &Name, const std::string &Reason) {
+        if (!IsSelected(Name)) {
+            return;
+        }
+        SkippedBenchmarks.emplace_back(Name, Reason);
+        std::cerr << Name << ": skipped (" << Reason << ")" << std::endl;
+    }
+
+    // Consumes the given value so the work that produced it is not optimized away.
+    void Benchmark::Consume(const double &Value) {
+        Sink = Sink + Value;
+    }
+
+    // EXPORT
+
+    // Returns each result as JSON.
+    std::string Benchmark::ToJson() {
+        std::string Json = "{\n\"build\":{";
+        Json += "\"headless\":" + std::string(HEADLESS ? "true" : "false");
+        Json += ",\"profiling\":" + std::string(PROFILING ? "true" : "false");
+#ifdef NDEBUG
+        Json += ",\"optimized\":true";
+#else
+        Json += ",\"optimized\":false";
+#endif
+        Json += ",\"hardware_threads\":" + std::to_string(std::thread::hardware_concurrency());
+        Json += "},\n\"unit\":\"ns_per_item\",\n\"benchmarks\":[";
+
+        char Numbers[256];
+        for (size_t i = 0; i < Results.size(); ++i) {
+            const Result &Measured = Results[i];
+            Json += i == 0 ? "\n{\"name\":" : ",\n{\"name\":";
+            AppendString(Json, Measured.Name);
+            std::snprintf(Numbers, sizeof(Numbers),
+                          ",\"items\":%lld,\"samples\":%d,\"mean\":%.3f,\"median\":%.3f,\"min\":%.3f,\"max\":%.3f,"
+                          "\"stddev\":%.3f}",
+                          Measured.Items, Measured.Samples, Measured.Mean, Measured.Median, Measured.Min,
+                          Measured.Max, Measured.StandardDeviation);
+            Json += Numbers;
+        }
+        Json += "\n],\n\"skipped\":[";
+
+        for (size_t i = 0; i < SkippedBenchmarks.size(); ++i) {
+            Json += i == 0 ? "\n{\"name\":" : ",\n{\"name\":";
+            AppendString(Json, SkippedBenchmarks[i].first);
+            Json += ",\"reason\":";
+            AppendString(Json, SkippedBenchmarks[i].second);
+            Json += "}";
+        }
+        Json += "\n]\n}\n";
+        return Json;
+    }
+
+    // Writes each result to the given file as JSON.
+    void Benchmark::ExportJson(const std::string &Path) {
+        std::ofstream File(Path, std::ios::binary);
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to open benchmark results file \"" + Path + "\" for writing!");
+        }
+        const std::string Json = ToJson();
+        File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+        if (!File) {
+            throw std::runtime_error("ERROR: Failed to write benchmark results file \"" + Path + "\"!");
+        }
+    }
+
+    // CLEAR
+
+    // Discards each result.
+    void Benchmark::Clear() {
+        Results.clear();
+        SkippedBenchmarks.clear();
+    }
+
+    // STATIC VARIABLE INITIALIZATION
+
+    // Each benchmark that was run, in the order it was run.
+    std::vector<Benchmark::Result> Benchmark::Results;
+
+    // The name of each benchmark that was skipped and why.
+    std::vector<std::pair<std::string, std::string> > Benchmark::SkippedBenchmarks;
+
+    // Values consumed by benchmarks so their work is not optimized away.
+    volatile double Benchmark::Sink = 0;
+
+    // The number of timed samples taken of each benchmark.
+    int Benchmark::Samples = BENCHMARK_SAMPLES;
+
+    // The number of untimed samples taken of each benchmark before it is measured.
+    int Benchmark::WarmupSamples = BENCHMARK_WARMUP_SAMPLES;
+
+    // Only benchmarks whose names contain this text are run.
+    std::string Benchmark::Filter;
+}
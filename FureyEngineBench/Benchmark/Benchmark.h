@@ -0,0 +1,114 @@
+// .h
+// Microbenchmark Script
+// by Kyle Furey
+
+#pragma once
+#include "../../FureyEngine/Standard/Standard.h"
+
+// The number of timed samples taken of each benchmark by default.
+#define BENCHMARK_SAMPLES 30
+
+// The number of untimed samples taken of each benchmark before it is measured.
+#define BENCHMARK_WARMUP_SAMPLES 3
+
+namespace FureyEngine {
+    /**
+     * A static class that times microbenchmarks and reports their results as JSON.<br/>
+     * Each benchmark is sampled several times, and each sample performs a known number of items,<br/>
+     * so each result is the time in nanoseconds each item took across every sample.
+     */
+    class Benchmark final {
+        // ABSTRACT CLASS
+
+        /** Prevents instantiation of this class. */
+        virtual void Abstract() = 0;
+
+        // RESULTS
+
+        /** The measured result of a benchmark, in nanoseconds per item. */
+        struct Result final {
+            /** The name of the benchmark. */
+            std::string Name;
+
+            /** The number of items each sample performed. */
+            long long Items = 0;
+
+            /** The number of timed samples. */
+            int Samples = 0;
+
+            /** The mean time of each item. */
+            double Mean = 0;
+
+            /** The median time of each item. */
+            double Median = 0;
+
+            /** The fastest time of each item. */
+            double Min = 0;
+
+            /** The slowest time of each item. */
+            double Max = 0;
+
+            /** The standard deviation of the time of each item. */
+            double StandardDeviation = 0;
+        };
+
+        /** Each benchmark that was run, in the order it was run. */
+        static std::vector<Result> Results;
+
+        /** The name of each benchmark that was skipped and why. */
+        static std::vector<std::pair<std::string, std::string> > SkippedBenchmarks;
+
+        /** Values consumed by benchmarks so their work is not optimized away. */
+        static volatile double Sink;
+
+        /** Appends the given text to the given JSON as a string. */
+        static void AppendString(std::string &Json, const std::string &Text);
+
+    public:
+        // SETTINGS
+
+        /** The number of timed samples taken of each benchmark. */
+        static int Samples;
+
+        /** The number of untimed samples taken of each benchmark before it is measured. */
+        static int WarmupSamples;
+
+        /** Only benchmarks whose names contain this text are run. */
+        static std::string Filter;
+
+        // RUNNING
+
+        /** Returns whether the benchmark with the given name passes the filter. */
+        [[nodiscard]] static bool IsSelected(const std::string &Name);
+
+        /**
+         * Times the given sample, which performs the given number of items.<br/>
+         * The setup and teardown are called before and after each sample without being timed.<br/>
+         * Benchmarks that do not pass the filter are not run.
+         */
+        static void Run(const std::string &Name,
+                        const long long &Items,
+                        const std::function<void()> &Sample,
+                        const std::function<void()> &Setup = nullptr,
+                        const std::function<void()> &Teardown = nullptr);
+
+        /** Records that the benchmark with the given name could not be run and why. */
+        static void Skip(const std::string &Name, const std::string &Reason);
+
+        /** Consumes the given value so the work that produced it is not optimized away. */
+        static void Consume(const double &Value);
+
+        // EXPORT
+
+        /** Returns each result as JSON. */
+        [[nodiscard]] static std::string ToJson();
+
+        /** Writes each result to the given file as JSON. */
+        static void ExportJson(const std::string &Path);
+
+        // CLEAR
+
+        /** Discards each result. */
+        static void Clear();
+    };
+}
@@ -0,0 +1,367 @@
+// .cpp
+// Furey Engine Microbenchmarks
+// by Kyle Furey
+
+#define SDL_MAIN_HANDLED 1
+#include "Benchmark/Benchmark.h"
+#include "../FureyEngine/FrameArena/FrameArena.h"
+#include "../FureyEngine/Delegate/Delegate.h"
+#include "../FureyEngine/Input/Input.h"
+#include "../FureyEngine/Renderer/Renderer.h"
+#include "../FureyEngine/Worlds/World.h"
+#include "../FureyEngine/Components/BrushComponent/BrushComponent.h"
+
+using namespace FureyEngine;
+
+// BENCHMARK TYPES
+
+/** A component that moves its actor each tick. */
+class MoverComponent final : public Component {
+public:
+    /** Moves this component's actor to the right. */
+    void Tick(const double &DeltaTime) override {
+        GetActor()->Transform.Position.x += static_cast<float>(DeltaTime);
+    }
+};
+
+/** A pooled actor that attaches a component when it first spawns. */
+class PooledActor final : public Actor {
+public:
+    /** Attaches a mover, which this actor keeps each time it is reused from its pool. */
+    void Spawn() override {
+        // Calls the base class's function
+        Actor::Spawn();
+
+        AttachComponent<MoverComponent>();
+    }
+};
+
+/** An object whose member function is bound to delegates. */
+struct Counter final {
+    /** The sum of each value this counter was invoked with. */
+    double Sum = 0;
+
+    /** Adds the given value to the sum. */
+    void Add(const double &Value) {
+        Sum += Value;
+    }
+};
+
+// BENCHMARKS
+
+/** Times spawning and destroying actors. */
+static void BenchmarkSpawning() {
+    for (const int Count: {100, 1000, 10000}) {
+        const auto SpawnWorld = std::make_shared<World>("Spawn");
+        const auto DestroyAll = [&SpawnWorld] {
+            for (const auto &Actor: SpawnWorld->Actors) {
+                SpawnWorld->DestroyActor(Actor.get());
+            }
+            SpawnWorld->FlushCommands();
+            FrameArena::ResetAll();
+        };
+
+        Benchmark::Run("World::SpawnActor/" + std::to_string(Count), Count, [&] {
+            for (int i = 0; i < Count; ++i) {
+                SpawnWorld->SpawnActor<Actor>(Transform({static_cast<float>(i), 0}));
+            }
+            SpawnWorld->FlushCommands();
+        }, nullptr, [&] {
+            SpawnWorld->Update();
+            DestroyAll();
+        });
+
+        Benchmark::Run("World::DestroyActor/" + std::to_string(Count), Count, DestroyAll, [&] {
+            for (int i = 0; i < Count; ++i) {
+                SpawnWorld->SpawnActor<Actor>(Transform({static_cast<float>(i), 0}));
+            }
+            SpawnWorld->Update();
+        });
+
+        // Each sample reuses the actors pooled by the previous one, which must not attach their components again
+        auto &Pool = SpawnWorld->GetActorPool<PooledActor>();
+        Benchmark::Run("ActorPool::Spawn/" + std::to_string(Count), Count, [&] {
+            for (int i = 0; i < Count; ++i) {
+                Pool.Spawn(Transform({static_cast<float>(i), 0}));
+            }
+            SpawnWorld->FlushCommands();
+        }, nullptr, [&] {
+            SpawnWorld->Update();
+            for (const auto &Actor: SpawnWorld->Actors) {
+                if (Actor->Components.size() != 1) {
+                    throw std::runtime_error("ERROR: A pooled actor attached its components again when reused!");
+                }
+            }
+            DestroyAll();
+        });
+    }
+}
+
+/** Times updating worlds of empty and moving actors. */
+static void BenchmarkUpdating() {
+    for (const bool Moving: {false, true}) {
+        for (const int Count: {100, 1000, 10000}) {
+            const std::string Name = std::string("World::Update/") + (Moving ? "moving/" : "empty/") +
+                                     std::to_string(Count);
+            if (!Benchmark::IsSelected(Name)) {
+                continue;
+            }
+
+            const auto UpdatedWorld = std::make_shared<World>("Update");
+            for (int i = 0; i < Count; ++i) {
+                const auto Spawned = UpdatedWorld->SpawnActor<Actor>(Transform({static_cast<float>(i), 0}));
+                if (Moving) {
+                    Spawned->AttachComponent<MoverComponent>();
+                }
+            }
+            UpdatedWorld->Update();
+            FrameArena::ResetAll();
+
+            Benchmark::Run(Name, Count, [&] {
+                UpdatedWorld->Update();
+            }, nullptr, [] {
+                FrameArena::ResetAll();
+            });
+        }
+    }
+}
+
+/** Times invoking delegates with lambda and member function bindings. */
+static void BenchmarkDelegates() {
+    constexpr int Invocations = 100000;
+    for (const int Bindings: {1, 16}) {
+        double Sum = 0;
+        Delegate<const double &> Lambdas;
+        for (int i = 0; i < Bindings; ++i) {
+            Lambdas.Bind([&Sum](const double &Value) { Sum += Value; });
+        }
+        Benchmark::Run("Delegate::Invoke/lambda/" + std::to_string(Bindings), Invocations, [&] {
+            for (int i = 0; i < Invocations; ++i) {
+                Lambdas.Invoke(1.0);
+            }
+            Benchmark::Consume(Sum);
+        });
+
+        Counter Counted;
+        Delegate<const double &> Members;
+        for (int i = 0; i < Bindings; ++i) {
+            Members.Bind<&Counter::Add>(&Counted);
+        }
+        Benchmark::Run("Delegate::Invoke/member/" + std::to_string(Bindings), Invocations, [&] {
+            for (int i = 0; i < Invocations; ++i) {
+                Members.Invoke(1.0);
+            }
+            Benchmark::Consume(Counted.Sum);
+        });
+    }
+}
+
+/** Times dereferencing references to live actors. */
+static void BenchmarkReferences() {
+    constexpr int Count = 1000;
+    constexpr int Passes = 100;
+    const auto ReferencedWorld = std::make_shared<World>("References");
+    std::vector<Reference<Actor> > References;
+    References.reserve(Count);
+    for (int i = 0; i < Count; ++i) {
+        References.push_back(ReferencedWorld->SpawnActor<Actor>(Transform({static_cast<float>(i), 0})).Get());
+    }
+    ReferencedWorld->Update();
+
+    Benchmark::Run("Reference::operator->/" + std::to_string(Count), static_cast<long long>(Count) * Passes, [&] {
+        double Sum = 0;
+        for (int Pass = 0; Pass < Passes; ++Pass) {
+            for (const auto &Referenced: References) {
+                Sum += Referenced->Transform.Position.x;
+            }
+        }
+        Benchmark::Consume(Sum);
+    });
+    FrameArena::ResetAll();
+}
+
+/** Times brushes testing each other for collision, with one item per pair of brushes tested. */
+static void BenchmarkCollision() {
+    for (const int Count: {16, 64, 256}) {
+        const std::string Name = "BrushComponent::Collision/" + std::to_string(Count);
+        if (!Benchmark::IsSelected(Name)) {
+            continue;
+        }
+
+        // Lay the brushes out in a grid where each brush overlaps its neighbors
+        const auto CollidingWorld = std::make_shared<World>("Collision");
+        const int Columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(Count))));
+        for (int i = 0; i < Count; ++i) {
+            const auto Spawned = CollidingWorld->SpawnActor<Actor>(
+                Transform({static_cast<float>(i % Columns), static_cast<float>(i / Columns)}));
+            Spawned->AttachComponent<BrushComponent>(Transform({0, 0}, 0, {1.5f, 1.5f}));
+        }
+        CollidingWorld->Update();
+        FrameArena::ResetAll();
+
+        Benchmark::Run(Name, static_cast<long long>(Count) * (Count - 1), [&] {
+            CollidingWorld->Update();
+        }, nullptr, [] {
+            FrameArena::ResetAll();
+        });
+    }
+}
+
+/** Times converting relative transforms into world transforms. */
+static void BenchmarkTransforms() {
+    constexpr int Count = 100000;
+    std::vector<Transform> Relative;
+    Relative.reserve(Count);
+    for (int i = 0; i < Count; ++i) {
+        Relative.emplace_back(glm::vec2{static_cast<float>(i % 100), static_cast<float>(i / 100)},
+                              static_cast<float>(i % 360), glm::vec2{1, 2});
+    }
+    const Transform Parent({10, -5}, 30, {2, 0.5f});
+
+    Benchmark::Run("Transform::RelativeToWorld", Count, [&] {
+        double Sum = 0;
+        for (const auto &Converted: Relative) {
+            Sum += Transform::RelativeToWorld(Converted, Parent).Position.x;
+        }
+        Benchmark::Consume(Sum);
+    });
+}
+
+/** Times polling synthetic key presses and releases, with one item per event. */
+static void BenchmarkInput() {
+    constexpr int Events = 1000;
+    int Fired = 0;
+    for (SDL_Keycode Key = SDLK_a; Key <= SDLK_z; ++Key) {
+        Input::KeyboardEvents[Key].Bind([&Fired](const ButtonState &) { ++Fired; });
+    }
+
+    bool Running = true;
+    Benchmark::Run("Input::Update/" + std::to_string(Events), Events, [&] {
+        Input::Update(Running);
+    }, [] {
+        // Queue alternating presses and releases of each letter without timing them
+        SDL_Event Event = {};
+        for (int i = 0; i < Events; ++i) {
+            Event.type = i % 2 == 0 ? SDL_KEYDOWN : SDL_KEYUP;
+            Event.key.keysym.sym = SDLK_a + i / 2 % 26;
+            SDL_PushEvent(&Event);
+        }
+    }, [] {
+        FrameArena::ResetAll();
+    });
+
+    Benchmark::Consume(Fired);
+    for (SDL_Keycode Key = SDLK_a; Key <= SDLK_z; ++Key) {
+        Input::KeyboardEvents[Key].Clear();
+    }
+}
+
+/** Times submitting textures to a renderer, with one item per texture. */
+static void BenchmarkRendering() {
+#if HEADLESS
+    Benchmark::Skip("Renderer::Render", "Headless builds have no window or OpenGL context.");
+#else
+    constexpr int Count = 1000;
+    const std::string Name = "Renderer::Render/" + std::to_string(Count);
+    if (!Benchmark::IsSelected(Name)) {
+        return;
+    }
+
+    // Rendering needs a window, which may be backed by a software OpenGL driver
+    std::unique_ptr<Window> BenchmarkWindow;
+    try {
+        BenchmarkWindow = std::make_unique<Window>("Furey Engine Benchmark", 640, 360);
+    } catch (const std::exception &Exception) {
+        Benchmark::Skip(Name, Exception.what());
+        return;
+    }
+    SDL_GL_SetSwapInterval(0);
+    {
+        Shader BenchmarkShader(ROOT"FureyEngine/Shader/VertexShader.glsl",
+                               ROOT"FureyEngine/Shader/FragmentShader.glsl");
+        Renderer BenchmarkRenderer(&BenchmarkShader, BenchmarkWindow.get());
+
+        // Upload a single white pixel that each texture draws
+        GLuint Pixel = 0;
+        const unsigned char White[4] = {255, 255, 255, 255};
+        glGenTextures(1, &Pixel);
+        glBindTexture(GL_TEXTURE_2D, Pixel);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, White);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        // Spread each texture across the screen so none are culled
+        std::vector<Transform> Transforms;
+        std::vector<Texture> Textures;
+        Transforms.reserve(Count);
+        Textures.reserve(Count);
+        for (int i = 0; i < Count; ++i) {
+            Transforms.emplace_back(glm::vec2{static_cast<float>(i % 40) * 2.5f - 48,
+                                              static_cast<float>(i / 40) * 2 - 24});
+            Textures.emplace_back(Pixel, glm::ivec2{32, 32}, &Transforms.back());
+            BenchmarkRenderer.DynamicTextures.push_back(&Textures.back());
+        }
+
+        Benchmark::Run(Name, Count, [&] {
+            BenchmarkRenderer.Clear();
+            BenchmarkRenderer.Render();
+        });
+
+        glDeleteTextures(1, &Pixel);
+    }
+#endif
+}
+
+// MAIN
+
+/**
+ * Runs each microbenchmark and writes their results as JSON.<br/>
+ * Arguments: [--out PATH] [--filter TEXT] [--samples COUNT].<br/>
+ * Results are written to the standard output unless a path is given.
+ */
+int main(int argc, char **argv) {
+    try {
+        std::string OutputPath;
+        for (int i = 1; i < argc; ++i) {
+            const std::string Argument = argv[i];
+            if (i + 1 >= argc) {
+                throw std::runtime_error("ERROR: Missing a value for benchmark argument \"" + Argument + "\"!");
+            }
+            if (Argument == "--out") {
+                OutputPath = argv[++i];
+            } else if (Argument == "--filter") {
+                Benchmark::Filter = argv[++i];
+            } else if (Argument == "--samples") {
+                Benchmark::Samples = std::stoi(argv[++i]);
+            } else {
+                throw std::runtime_error("ERROR: Unknown benchmark argument \"" + Argument + "\"!");
+            }
+        }
+
+        // Synthetic input events need SDL's event queue
+        if (SDL_Init(SDL_INIT_EVENTS | SDL_INIT_TIMER) != 0) {
+            throw std::runtime_error("ERROR: SDL failed to initialize!\nSDL Error: " +
+                                     std::string(SDL_GetError()));
+        }
+
+        BenchmarkSpawning();
+        BenchmarkUpdating();
+        BenchmarkDelegates();
+        BenchmarkReferences();
+        BenchmarkCollision();
+        BenchmarkTransforms();
+        BenchmarkInput();
+        BenchmarkRendering();
+
+        if (OutputPath.empty()) {
+            std::cout << Benchmark::ToJson();
+        } else {
+            Benchmark::ExportJson(OutputPath);
+        }
+
+        SDL_Quit();
+        return 0;
+    } catch (const std::exception &Exception) {
+        std::cerr << Exception.what() << std::endl;
+        return 1;
+    }
+}